@@ -0,0 +1,211 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "barrverbmulti.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <thread>
+
+#include "rom.h"
+
+START_NAMESPACE_DISTRHO
+
+BarrVerbMulti::BarrVerbMulti() : Plugin(kParameterCount, 64, 0) {
+    for (uint32_t b = 0; b < kBatches; b++) batches[b].setSampleRate(getSampleRate());
+    meter.setSampleRate(getSampleRate());
+    loadProgram(19);
+    programChanged();
+}
+
+BarrVerbMulti::~BarrVerbMulti() {
+    delete pool;
+}
+
+// Initialisation functions
+
+void BarrVerbMulti::initParameter(uint32_t index, Parameter &parameter) {
+    if (index == paramProgram) {
+        parameter.hints = kParameterIsAutomatable | kParameterIsInteger;
+        parameter.name = "Program";
+        parameter.symbol = "program";
+        parameter.ranges.def = 20.0f;
+        parameter.ranges.min = 1.0f;
+        parameter.ranges.max = 64.0f;
+    }
+    if (index == paramThreads) {
+        // share the engines out across cores, only makes a difference with more than 16 channels
+        parameter.hints = kParameterIsBoolean;
+        parameter.name = "Worker Threads";
+        parameter.symbol = "threads";
+        parameter.ranges.def = 1.0f;
+        parameter.ranges.min = 0.0f;
+        parameter.ranges.max = 1.0f;
+    }
+    if (index == paramLoad) {
+        // as a percentage of the time available for each block
+        parameter.hints = kParameterIsOutput;
+        parameter.name = "DSP Load";
+        parameter.symbol = "load";
+        parameter.unit = "%";
+        parameter.ranges.def = 0.0f;
+        parameter.ranges.min = 0.0f;
+        parameter.ranges.max = 200.0f;
+    }
+}
+
+void BarrVerbMulti::setParameterValue(uint32_t index, float value) {
+    if (index == paramProgram) {
+        program = value;
+    }
+    if (index == paramThreads) {
+        threads = value > 0.5f;
+    }
+}
+
+float BarrVerbMulti::getParameterValue(uint32_t index) const {
+    if (index == paramProgram) {
+        return program;
+    }
+    if (index == paramThreads) {
+        return threads;
+    }
+    if (index == paramLoad) {
+        return meter.getLoad() * 100;
+    }
+    return 0;
+}
+
+void BarrVerbMulti::initAudioPort(bool input, uint32_t index, AudioPort &port) {
+    Plugin::initAudioPort(input, index, port);
+
+    // "In 3 Left" and so on, numbered by pair
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%s %u %s", input ? "In" : "Out", index / 2 + 1, index & 1 ? "Right" : "Left");
+    port.name = buf;
+    snprintf(buf, sizeof(buf), "%s_%u", input ? "in" : "out", index + 1);
+    port.symbol = buf;
+}
+
+void BarrVerbMulti::initProgramName(uint32_t index, String &programName) {
+    programName = prog_name[index & 0x3f];
+}
+
+void BarrVerbMulti::loadProgram(uint32_t index) {
+    program = index + 1;
+}
+
+void BarrVerbMulti::programChanged() {
+    const uint8_t prog = (program - 1) & 0x3f;
+    for (uint32_t b = 0; b < kBatches; b++) {
+        batches[b].setProgram(prog);
+        // the new program might make something of whatever is left in the RAM
+        gates[b].setTail(programDecay(prog_name[prog]), getSampleRate());
+        gates[b].wake();
+    }
+}
+
+// Processing functions
+
+void BarrVerbMulti::sampleRateChanged(double newSampleRate) {
+    for (uint32_t b = 0; b < kBatches; b++) {
+        batches[b].setSampleRate(newSampleRate);
+        gates[b].setTail(programDecay(prog_name[(program - 1) & 0x3f]), newSampleRate);
+    }
+    meter.setSampleRate(newSampleRate);
+}
+
+void BarrVerbMulti::activate() {
+    for (uint32_t b = 0; b < kBatches; b++) {
+        if (!batches[b].activate()) d_stderr("BarrVerbMulti: couldn't allocate DSP RAM");
+        gates[b].wake();
+    }
+
+    // the audio thread runs one batch itself, so one worker fewer than batches,
+    // and no more than there are other cores to run them
+    uint32_t cores = std::thread::hardware_concurrency();
+    uint32_t workers = kBatches - 1;
+    if (cores && workers > cores - 1) workers = cores - 1;
+    if (workers && !pool) pool = new RtWorkerPool(workers);
+
+    meter.resetPeak();
+}
+
+void BarrVerbMulti::deactivate() {
+    delete pool;
+    pool = nullptr;
+    for (uint32_t b = 0; b < kBatches; b++) batches[b].deactivate();
+}
+
+void BarrVerbMulti::runBatch(void *ctx, uint32_t index) {
+    BarrVerbMulti *self = (BarrVerbMulti *)ctx;
+    const uint32_t first = index * EngineBatch::kLanes;
+    uint32_t lanes = kEngines - first;
+    if (lanes > EngineBatch::kLanes) lanes = EngineBatch::kLanes;
+
+    const float *inL[EngineBatch::kLanes] = {}, *inR[EngineBatch::kLanes] = {};
+    float *outL[EngineBatch::kLanes] = {}, *outR[EngineBatch::kLanes] = {};
+    const uint32_t frames = self->block_frames;
+    bool silent = true, quiet = true;
+    for (uint32_t l = 0; l < lanes; l++) {
+        inL[l] = self->block_in[2 * (first + l)];
+        inR[l] = self->block_in[2 * (first + l) + 1];
+        outL[l] = self->block_out[2 * (first + l)];
+        outR[l] = self->block_out[2 * (first + l) + 1];
+        silent = silent && SleepGate::silent(inL[l], frames) && SleepGate::silent(inR[l], frames);
+    }
+
+    SleepGate &gate = self->gates[index];
+    if (silent && gate.isAsleep()) {
+        for (uint32_t l = 0; l < lanes; l++) {
+            memset(outL[l], 0, sizeof(float) * frames);
+            memset(outR[l], 0, sizeof(float) * frames);
+        }
+        return;
+    }
+
+    self->batches[index].run(inL, inR, outL, outR, lanes, frames);
+    for (uint32_t l = 0; l < lanes && quiet; l++) {
+        quiet = SleepGate::quiet(outL[l], frames) && SleepGate::quiet(outR[l], frames);
+    }
+    gate.update(silent, quiet, frames);
+}
+
+void BarrVerbMulti::run(const float **inputs, float **outputs, uint32_t frames) {
+    meter.begin();
+
+    if (batches[0].getProgram() != ((program - 1) & 0x3f)) programChanged();
+
+    block_in = inputs;
+    block_out = outputs;
+    block_frames = frames;
+
+    if (pool && threads) {
+        pool->run(kBatches, runBatch, this);
+    } else {
+        for (uint32_t b = 0; b < kBatches; b++) runBatch(this, b);
+    }
+
+    meter.end(frames);
+}
+
+// create the plugin
+Plugin *createPlugin() { return new BarrVerbMulti(); }
+
+END_NAMESPACE_DISTRHO
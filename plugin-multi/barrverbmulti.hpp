@@ -0,0 +1,107 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_MULTI_HPP
+#define BARRVERB_MULTI_HPP
+
+#include <atomic>
+
+#include "DistrhoPlugin.hpp"
+#include "batch.hpp"
+#include "loadmeter.hpp"
+#include "rtpool.hpp"
+#include "sleep.hpp"
+
+START_NAMESPACE_DISTRHO
+
+// BarrVerb for multichannel busses
+// Each pair of channels gets an engine of its own, summed to mono on the way
+// in like the stereo plugin, and they all run the same program
+// The engines are run eight at a time in an EngineBatch, and with more than
+// one batch the batches are shared out between the audio thread and a few
+// realtime worker threads
+class BarrVerbMulti : public Plugin {
+   public:
+    static const uint32_t kChannels = DISTRHO_PLUGIN_NUM_INPUTS;
+    static const uint32_t kEngines = kChannels / 2;
+    static const uint32_t kBatches = (kEngines + EngineBatch::kLanes - 1) / EngineBatch::kLanes;
+
+    enum Parameters {
+        paramProgram,
+        paramThreads,
+        paramLoad,
+        kParameterCount
+    };
+
+    BarrVerbMulti();
+    ~BarrVerbMulti();
+
+   protected:
+    const char *getLabel() const override { return "BarrVerbMulti"; }
+    const char *getDescription() const override {
+        return "MIDIVerb emulation for multichannel busses, one engine per pair of channels";
+    }
+    const char *getMaker() const override { return "Gordonjcp"; }
+    const char *getLicense() const override { return "ISC"; }
+    uint32_t getVersion() const override { return d_version(1, 0, 0); }
+    int64_t getUniqueId() const override { return d_cconst('B', 'R', 'M', 'C'); }
+
+    // Initialisation
+    void initAudioPort(bool input, uint32_t index, AudioPort &port) override;
+    void initParameter(uint32_t index, Parameter &parameter) override;
+
+    void setParameterValue(uint32_t index, float value) override;
+    float getParameterValue(uint32_t index) const override;
+
+    void initProgramName(uint32_t index, String &programName) override;
+    void loadProgram(uint32_t index) override;
+
+    // Processing
+    void sampleRateChanged(double newSampleRate) override;
+    void activate() override;
+    void deactivate() override;
+    void run(const float **inputs, float **outputs, uint32_t frames) override;
+
+   private:
+    static_assert(kChannels % 2 == 0, "channels come in pairs");
+
+    static void runBatch(void *ctx, uint32_t index);
+    void programChanged();
+
+    // a batch sleeps when all eight of its engines are silent
+    EngineBatch batches[kBatches];
+    SleepGate gates[kBatches];
+    RtWorkerPool *pool = nullptr;
+    LoadMeter meter;
+
+    // set from any thread, run() gives it to the batches and their gates
+    // before any of them are started, since the workers read them too
+    std::atomic<uint8_t> program{20};
+    bool threads = true;
+
+    // the block being worked on, for runBatch()
+    const float **block_in = nullptr;
+    float **block_out = nullptr;
+    uint32_t block_frames = 0;
+
+    DISTRHO_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BarrVerbMulti);
+};
+
+END_NAMESPACE_DISTRHO
+
+#endif  // BARRVERB_MULTI_HPP
@@ -27,8 +27,11 @@
 #define DISTRHO_PLUGIN_NUM_OUTPUTS 2
 
 #define DISTRHO_PLUGIN_IS_RT_SAFE 1
+#define DISTRHO_PLUGIN_WANT_LATENCY 1
 
 #define DISTRHO_PLUGIN_WANT_PROGRAMS 1
+#define DISTRHO_PLUGIN_WANT_STATE 1
+#define DISTRHO_PLUGIN_WANT_FULL_STATE 1
 
 #define DISTRHO_PLUGIN_UNIQUE_ID BARR
 #define DISTRHO_PLUGIN_BRAND_ID GJCP
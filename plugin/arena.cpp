@@ -0,0 +1,128 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "arena.hpp"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <mutex>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if defined(BARRVERB_HUGEPAGES) && defined(MADV_HUGEPAGE)
+#define ARENA_HUGEPAGES 1
+#endif
+
+static const size_t kHugePageSize = 2 * 1024 * 1024;
+
+#ifdef BARRVERB_HUGEPAGES
+// one huge page per slab
+static const size_t kSlabSize = kHugePageSize;
+#else
+static const size_t kSlabSize = 16 * kArenaBlockSize;
+#endif
+static const size_t kSlabBlocks = kSlabSize / kArenaBlockSize;
+
+// free blocks are chained through their first word
+struct FreeBlock {
+    FreeBlock *next;
+};
+
+static std::mutex arena_lock;
+static FreeBlock *free_list = nullptr;
+
+static char *mapSlab(size_t size) {
+#ifdef _WIN32
+    char *slab = (char *)VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (!slab) return nullptr;
+    memset(slab, 0, size);
+    VirtualLock(slab, size);  // best effort, the working set may be too small
+#elif defined(ARENA_HUGEPAGES)
+    // a huge page has to start on a boundary of its own size, which mmap()
+    // doesn't promise, so map a huge page's worth extra and trim it off
+    const size_t page = sysconf(_SC_PAGESIZE);
+    const size_t mapped = (size + page - 1) & ~(page - 1);
+    char *raw = (char *)mmap(nullptr, mapped + kHugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                             -1, 0);
+    if (raw == MAP_FAILED) return nullptr;
+    char *slab = (char *)(((uintptr_t)raw + kHugePageSize - 1) & ~(uintptr_t)(kHugePageSize - 1));
+    if (slab > raw) munmap(raw, slab - raw);
+    munmap(slab + mapped, raw + kHugePageSize - slab);
+    madvise(slab, size, MADV_HUGEPAGE);
+#else
+    char *slab = (char *)mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (slab == MAP_FAILED) return nullptr;
+#endif
+#ifndef _WIN32
+    // fault every page in now, rather than on the audio thread later
+    memset(slab, 0, size);
+    mlock(slab, size);  // best effort, RLIMIT_MEMLOCK is often small
+#endif
+    return slab;
+}
+
+static bool grow() {
+    char *slab = mapSlab(kSlabSize);
+    if (!slab) return false;
+
+    for (size_t i = 0; i < kSlabBlocks; i++) {
+        FreeBlock *block = (FreeBlock *)(slab + i * kArenaBlockSize);
+        block->next = free_list;
+        free_list = block;
+    }
+    return true;
+}
+
+void *arenaAcquire() {
+    std::lock_guard<std::mutex> lock(arena_lock);
+    if (!free_list && !grow()) return nullptr;
+
+    FreeBlock *block = free_list;
+    free_list = block->next;
+    return block;
+}
+
+void arenaRelease(void *ptr) {
+    if (!ptr) return;
+
+    std::lock_guard<std::mutex> lock(arena_lock);
+    FreeBlock *block = (FreeBlock *)ptr;
+    block->next = free_list;
+    free_list = block;
+}
+
+void *arenaMap(size_t bytes) {
+    return mapSlab(bytes);
+}
+
+void arenaUnmap(void *ptr, size_t bytes) {
+    if (!ptr) return;
+
+#ifdef _WIN32
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    munlock(ptr, bytes);
+    munmap(ptr, bytes);
+#endif
+}
@@ -0,0 +1,48 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_ARENA_HPP
+#define BARRVERB_ARENA_HPP
+
+#include <stddef.h>
+
+// 16kW of DSP RAM
+static const size_t kRamWords = 16384;
+static const size_t kRamBytes = kRamWords * 2;
+
+// each block holds one engine's complete state, RAM and all
+static const size_t kArenaBlockSize = 36 * 1024;
+
+// Process-wide arena of engine state blocks
+// Blocks are carved out of larger slabs which are kept for reuse, so an
+// instance that is only ever activated and deactivated doesn't go back to
+// the heap each time, and inactive instances hold no delay memory at all
+// Slabs are touched all the way through and locked into memory when they
+// are created, so the audio thread never takes a page fault on first use
+// Building with BARRVERB_HUGEPAGES asks for transparent huge pages as well,
+// which is worthwhile when there are dozens of instances
+// Both of these take a lock, so call them from activate() and deactivate()
+void *arenaAcquire();
+void arenaRelease(void *block);
+
+// Memory too big for an arena block, prefaulted and locked in the same way
+// and handed straight back to the OS when it's unmapped
+void *arenaMap(size_t bytes);
+void arenaUnmap(void *ptr, size_t bytes);
+
+#endif  // BARRVERB_ARENA_HPP
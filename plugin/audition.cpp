@@ -0,0 +1,83 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "audition.hpp"
+
+#include <string.h>
+
+#include "denormals.hpp"
+
+AuditionBank::AuditionBank(uint32_t threads) : pool(threads) {
+    kern = kernelsSelect();
+    for (uint32_t i = 0; i < kPrograms; i++) engines[i].setProgram(i);
+
+    memset(&filter, 0, sizeof(filter));
+    cascadeDesign(filter, 48000);
+}
+
+bool AuditionBank::activate() {
+    for (uint32_t i = 0; i < kPrograms; i++) {
+        if (!engines[i].activate()) {
+            deactivate();
+            return false;
+        }
+    }
+    reset();
+    return true;
+}
+
+void AuditionBank::deactivate() {
+    for (uint32_t i = 0; i < kPrograms; i++) engines[i].deactivate();
+}
+
+void AuditionBank::setSampleRate(float rate) {
+    cascadeDesign(filter, rate);
+    for (uint32_t i = 0; i < kPrograms; i++) engines[i].setSampleRate(rate);
+}
+
+void AuditionBank::setRom(const RomImage *image) {
+    for (uint32_t i = 0; i < kPrograms; i++) engines[i].setRom(image);
+}
+
+void AuditionBank::reset() {
+    memset(filter.s, 0, sizeof(filter.s));
+    filter.fill = 0;
+    for (uint32_t i = 0; i < kPrograms; i++) engines[i].reset();
+}
+
+void AuditionBank::run(const float *inL, const float *inR, float *const *outL, float *const *outR,
+                       uint32_t frames) {
+    if (filtered.size() < frames) filtered.resize(frames);
+
+    {
+        ScopedDenormals ftz;
+        kern->mixFloat(inL, inR, filtered.data(), frames);
+        kern->cascade(filter, filtered.data(), frames);
+    }
+
+    out_l = outL;
+    out_r = outR;
+    this->frames = frames;
+    pool.run(kPrograms, job, this);
+}
+
+void AuditionBank::job(void *ctx, uint32_t index) {
+    AuditionBank *bank = (AuditionBank *)ctx;
+    bank->engines[index].runPrefiltered(bank->filtered.data(), bank->out_l[index], bank->out_r[index],
+                                        bank->frames);
+}
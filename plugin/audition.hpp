@@ -0,0 +1,68 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_AUDITION_HPP
+#define BARRVERB_AUDITION_HPP
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "cascade.hpp"
+#include "engine.hpp"
+#include "workers.hpp"
+
+// Every program in the ROM run on the same input at once, for choosing one
+// The input is summed and filtered once and shared, since that part doesn't
+// depend on the program, and then each engine runs its program over the
+// whole of run()'s input in one go on whichever core picks it up, so its
+// RAM stays in that core's cache for the duration
+// Pass a few thousand frames at a time for that to pay off
+class AuditionBank {
+   public:
+    static const uint32_t kPrograms = 64;
+
+    // threads as for WorkerPool, 0 for one per core
+    explicit AuditionBank(uint32_t threads = 0);
+
+    bool activate();
+    void deactivate();
+
+    void setSampleRate(float rate);
+    void setRom(const RomImage *image);  // not copied, must outlive its use
+    void reset();
+
+    // outL[p] and outR[p] get program p's output, for each of the 64
+    void run(const float *inL, const float *inR, float *const *outL, float *const *outR, uint32_t frames);
+
+   private:
+    static void job(void *ctx, uint32_t index);
+
+    BarrEngine engines[kPrograms];
+    const Kernels *kern;
+    Cascade filter;
+    std::vector<float> filtered;
+    WorkerPool pool;
+
+    // the batch being worked on
+    float *const *out_l = nullptr;
+    float *const *out_r = nullptr;
+    uint32_t frames = 0;
+};
+
+#endif  // BARRVERB_AUDITION_HPP
@@ -18,51 +18,28 @@
 
 #include "barrverb.hpp"
 
-#include "rom.h"
-
-/*
-
-SVF::SVF(float cutoff, float q, float samplerate) {
-    z1 = z2 = 0;
-    setFreq(cutoff, q, samplerate);
-}
-*/
-
-void SVF::setFreq(float cutoff, float q, float samplerate) {
-    z1 = z2 = 0;
-
-    //printf("called with %f %f %f\n", cutoff, q, samplerate);
-    w = 2 * tan(3.14159 * (cutoff / samplerate));
-    a = w / q;
-    b = w * w;
+#include <vector>
 
-    // corrected SVF params, per Fons Adriaensen
-    c1 = (a + b) / (1 + a / 2 + b / 4);
-    c2 = b / (a + b);
+#include "extra/Base64.hpp"
 
-    d0 = c1 * c2 / 4;
-
-    //printf("c1 %f c2 %f d0 %f\n", c1, c2, d0);
-}
-
-inline float SVF::lpStep(float in) {
-    x = in - z1 - z2;
-    z2 += c2 * z1;
-    z1 += c1 * x;
-    return d0 * x + z2;
-}
+#include "rom.h"
 
 START_NAMESPACE_DISTRHO
 
-BarrVerb::BarrVerb() : Plugin(kParameterCount, 64, 0) {  // one parameter, 64 programs, no states
-    lowpass = new float[getBufferSize()];
-    ram = new int16_t[16384];
-
-    memset(lowpass, 0, sizeof(float) * getBufferSize());
-    memset(ram, 0, sizeof(int16_t) * 16384);
+BarrVerb::BarrVerb() : Plugin(kParameterCount, 64, kStateCount) {
+    rom_current = romRetain(romBuiltin());
+    capture_buf = new EngineSnapshot;
+    engine.setSampleRate(getSampleRate());
+    meter.setSampleRate(getSampleRate());
+    loadProgram(19);
+    programChanged();
+    telemetry.attach();
+}
 
-    f1.setFreq(5916, .6572, getSampleRate());
-    f2.setFreq(9458, 2.536, getSampleRate());
+BarrVerb::~BarrVerb() {
+    if (rom_loader.joinable()) rom_loader.join();
+    romFree(rom_current);
+    delete capture_buf;
 }
 
 // Initialisation functions
@@ -76,12 +53,65 @@ void BarrVerb::initParameter(uint32_t index, Parameter &parameter) {
         parameter.ranges.min = 1.0f;
         parameter.ranges.max = 64.0f;
     }
+    if (index == paramLoad || index == paramPeakLoad) {
+        // as a percentage of the time available for each block
+        parameter.hints = kParameterIsOutput;
+        parameter.name = index == paramLoad ? "DSP Load" : "Peak DSP Load";
+        parameter.symbol = index == paramLoad ? "load" : "peak_load";
+        parameter.unit = "%";
+        parameter.ranges.def = 0.0f;
+        parameter.ranges.min = 0.0f;
+        parameter.ranges.max = 200.0f;
+    }
+    if (index == paramSaveTail) {
+        // store the whole engine with the session, so reverb tails survive a reload
+        parameter.hints = kParameterIsBoolean;
+        parameter.name = "Save Tail";
+        parameter.symbol = "save_tail";
+        parameter.ranges.def = 0.0f;
+        parameter.ranges.min = 0.0f;
+        parameter.ranges.max = 1.0f;
+    }
+    if (index == paramThreadLatency) {
+        // run the engine on a thread of its own this far behind the host,
+        // 0 runs it in the host's callback
+        // Hosts only expect the latency to change on activation, so that's
+        // when it takes effect
+        parameter.hints = kParameterIsInteger;
+        parameter.name = "Thread Latency";
+        parameter.symbol = "thread_latency";
+        parameter.unit = "ms";
+        parameter.ranges.def = 0.0f;
+        parameter.ranges.min = 0.0f;
+        parameter.ranges.max = 100.0f;
+    }
+}
+
+void BarrVerb::initState(uint32_t index, State &state) {
+    if (index == stateRom) {
+        state.hints = kStateIsFilenamePath;
+        state.key = "rom";
+        state.defaultValue = "";
+        state.label = "ROM image";
+        state.description = "MIDIVerb-style DSP ROM, either a raw EPROM dump or a permuted image";
+    }
+    if (index == stateSnapshot) {
+        state.hints = kStateIsBase64Blob | kStateIsOnlyForDSP;
+        state.key = "snapshot";
+        state.defaultValue = "";
+        state.label = "Engine snapshot";
+    }
 }
 
 void BarrVerb::setParameterValue(uint32_t index, float value) {
     if (index == paramProgram) {
         program = value;
-        prog_offset = (((int)value - 1) & 0x3f) << 7;
+    }
+    if (index == paramSaveTail) {
+        save_tail = value > 0.5f;
+    }
+    if (index == paramThreadLatency) {
+        thread_latency = value;
     }
 }
 
@@ -89,6 +119,18 @@ float BarrVerb::getParameterValue(uint32_t index) const {
     if (index == paramProgram) {
         return program;
     }
+    if (index == paramLoad) {
+        return meter.getLoad() * 100;
+    }
+    if (index == paramPeakLoad) {
+        return meter.getPeak() * 100;
+    }
+    if (index == paramSaveTail) {
+        return save_tail;
+    }
+    if (index == paramThreadLatency) {
+        return thread_latency;
+    }
     return 0;
 }
 
@@ -103,92 +145,164 @@ void BarrVerb::initAudioPort(bool input, uint32_t index, AudioPort &port) {
 }
 
 void BarrVerb::initProgramName(uint32_t index, String &programName) {
-    programName = prog_name[index & 0x3f].c_str();
+    programName = prog_name[index & 0x3f];
 }
 
 void BarrVerb::loadProgram(uint32_t index) {
-    prog_offset = (index & 0x3f) << 7;
     program = index + 1;
 }
 
+void BarrVerb::programChanged() {
+    engine.setProgram(program - 1);
+
+    // the new program might make something of whatever is left in the RAM
+    gate.setTail(programDecay(prog_name[engine.getProgram()]), getSampleRate());
+    gate.wake();
+}
+
+String BarrVerb::getState(const char *key) const {
+    if (!strcmp(key, "rom")) {
+        return rom_path;
+    }
+    if (!strcmp(key, "snapshot")) {
+        if (!save_tail || !engine.isActive()) return String();
+
+        // ask the audio thread for a copy taken between two blocks
+        capture_requested.store(true);
+        if (!capture_ready.wait(200)) {
+            // the host isn't calling run() just now, and the engine can't be
+            // touched from here in case it starts again, so withdraw the
+            // request and make do with the last snapshot there was
+            if (capture_requested.exchange(false)) return last_snapshot;
+
+            // run() picked the request up at the last moment
+            capture_ready.wait();
+        }
+
+        std::vector<uint8_t> data(kSnapshotMaxBytes);
+        size_t size = snapshotEncode(*capture_buf, data.data());
+        last_snapshot = String::asBase64(data.data(), size);
+        return last_snapshot;
+    }
+    return String();
+}
+
+void BarrVerb::setState(const char *key, const char *value) {
+    if (!strcmp(key, "rom")) {
+        // loading can take as long as it likes, run() only ever sees the finished image
+        rom_path = value;
+        if (rom_loader.joinable()) rom_loader.join();
+        rom_loader = std::thread(&BarrVerb::loadRom, this, String(value));
+    }
+    if (!strcmp(key, "snapshot")) {
+        if (!value[0]) return;
+
+        // decode it here, so that restoring in run() is just a copy
+        std::vector<uint8_t> data = d_getChunkFromBase64String(value);
+        EngineSnapshot *snap = new EngineSnapshot;
+        if (snapshotDecode(data.data(), data.size(), *snap)) {
+            snap_handoff.publish(snap);
+        } else {
+            d_stderr("BarrVerb: ignoring a damaged engine snapshot");
+            delete snap;
+        }
+    }
+}
+
+void BarrVerb::loadRom(String path) {
+    // an empty path puts the built-in ROM back
+    const RomImage *image = path.isEmpty() ? romRetain(romBuiltin()) : romLoad(path);
+    if (image == nullptr) {
+        d_stderr("BarrVerb: %s is not a usable ROM image", path.buffer());
+        return;
+    }
+    rom_handoff.publish(image);
+}
+
 // Processing functions
 
+void BarrVerb::sampleRateChanged(double newSampleRate) {
+    engine.setSampleRate(newSampleRate);
+    meter.setSampleRate(newSampleRate);
+    gate.setTail(programDecay(prog_name[engine.getProgram()]), newSampleRate);
+}
+
 void BarrVerb::activate() {
-    // calculate filter coefficients
-    //printf("called activate()\n");
+    // engine state comes out of the shared arena, so bypassed instances hold none
+    if (!engine.activate()) d_stderr("BarrVerb: couldn't allocate DSP RAM");
+    meter.resetPeak();
+    gate.wake();
+
+    // no latency if the host's buffers are too big for the thread, and then
+    // run() does the work itself as usual
+    if (thread_latency) {
+        uint32_t latency = engine_thread.start(thread_latency * getSampleRate() / 1000, getBufferSize());
+        setLatency(latency);
+    } else {
+        setLatency(0);
+    }
 }
 
 void BarrVerb::deactivate() {
-    // zero out the outputs, maybe
-   // printf("called deactivate()\n");
+    engine_thread.stop();
+    engine.deactivate();
 }
 
 void BarrVerb::run(const float **inputs, float **outputs, uint32_t frames) {
-    // actual effects here
-
-    uint16_t opcode = 0;
-
-    for (uint32_t i = 0; i < frames; i++) {
-        // smash to mono
-        lowpass[i] = f2.lpStep(f1.lpStep((inputs[0][i] + inputs[1][i]) / 2));
-    }
-
-    // now run the DSP
-    for (uint32_t i = 0; i < frames; i += 2) {
-        // run the actual DSP engine for each sample
-        for (uint8_t step = 0; step < 128; step++) {
-            opcode = rom[prog_offset + step];
-            switch (opcode & 0xc000) {
-                case 0x0000:
-                    ai = ram[ptr];
-                    li = acc + (ai >> 1);
-                    break;
-                case 0x4000:
-                    ai = ram[ptr];
-                    li = (ai >> 1);
-                    break;
-                case 0x8000:
-                    ai = acc;
-                    ram[ptr] = ai;
-                    li = acc + (ai >> 1);
-                    break;
-                case 0xc000:
-                    ai = acc;
-                    ram[ptr] = -ai;
-                    li = -(ai >> 1);
-                    break;
-            }
-
-            // clamp
-            if (ai > 2047) ai = 2047;
-            if (ai < -2047) ai = -2047;
-
-            if (step == 0x00) {
-                // load RAM from ADC
-                ram[ptr] = (int)(lowpass[i] * 2048);
-            } else if (step == 0x60) {
-                // output right channel
-                // ai=0;
-                outputs[1][i] = (float)ai / 2048;
-                outputs[1][i + 1] = (float)ai / 2048;
-
-            } else if (step == 0x70) {
-                // output left channel
-                // ai=0;
-                outputs[0][i] = (float)ai / 2048;
-                outputs[0][i + 1] = (float)ai / 2048;
-            } else {
-                // everything else
-                // ADC and DAC operations don't affect the accumulator
-                // every other step ends with the accumulator latched from the Latch Input reg
-                acc = li;
-            }
-
-            // 16kW of RAM
-            ptr += opcode & 0x3fff;
-            ptr &= 0x3fff;
-        }
+    if (engine_thread.isRunning()) {
+        engine_thread.run(inputs[0], inputs[1], outputs[0], outputs[1], frames);
+    } else {
+        process(inputs[0], inputs[1], outputs[0], outputs[1], frames);
+    }
+
+    telemetry.publish(program, asleep.load(std::memory_order_relaxed), meter, outputs[0], outputs[1], frames);
+}
+
+void BarrVerb::processThread(void *ctx, const float *inL, const float *inR, float *outL, float *outR,
+                             uint32_t frames) {
+    ((BarrVerb *)ctx)->process(inL, inR, outL, outR, frames);
+}
+
+void BarrVerb::process(const float *inL, const float *inR, float *outL, float *outR, uint32_t frames) {
+    meter.begin();
+
+    if (engine.getProgram() != ((program - 1) & 0x3f)) programChanged();
+
+    // pick up a newly loaded ROM, if there is one
+    const RomImage *image = rom_handoff.take();
+    if (image) {
+        rom_handoff.retire(rom_current);
+        rom_current = image;
+        engine.setRom(image);
+        gate.wake();
+    }
+
+    // and a restored snapshot
+    EngineSnapshot *snap = snap_handoff.take();
+    if (snap) {
+        engine.apply(*snap);
+        snap_handoff.retire(snap);
+        gate.wake();
+    }
+
+    // actual effects here, unless there's nothing going in and the tail has died away
+    bool silent = SleepGate::silent(inL, frames) && SleepGate::silent(inR, frames);
+    if (silent && gate.isAsleep()) {
+        memset(outL, 0, sizeof(float) * frames);
+        memset(outR, 0, sizeof(float) * frames);
+    } else {
+        engine.run(inL, inR, outL, outR, frames);
+        gate.update(silent, SleepGate::quiet(outL, frames) && SleepGate::quiet(outR, frames), frames);
+    }
+    asleep.store(gate.isAsleep(), std::memory_order_relaxed);
+
+    // hand getState() a copy of the engine if it's waiting for one
+    if (capture_requested.load(std::memory_order_relaxed) && capture_requested.exchange(false)) {
+        engine.capture(*capture_buf);
+        capture_ready.post();
     }
+
+    meter.end(frames);
 }
 
 // create the plugin
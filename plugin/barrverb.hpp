@@ -19,19 +19,16 @@
 #ifndef BARRVERB_HPP
 #define BARRVERB_HPP
 
-#include "DistrhoPlugin.hpp"
-
-class SVF {
-   public:
-    //SVF(float cutoff, float q, float samplerate);
-    void setFreq(float cutoff, float q, float samplerate);
-    float lpStep(float in);
+#include <atomic>
+#include <thread>
 
-   private:
-    float w, a, b;
-    float c1, c2, d0;
-    float z1, z2, x;
-};
+#include "DistrhoPlugin.hpp"
+#include "engine.hpp"
+#include "enginethread.hpp"
+#include "loadmeter.hpp"
+#include "ringbuffer.hpp"
+#include "sleep.hpp"
+#include "telemetry.hpp"
 
 START_NAMESPACE_DISTRHO
 
@@ -39,10 +36,24 @@ class BarrVerb : public Plugin {
    public:
     enum Parameters {
         paramProgram,
+        paramLoad,
+        paramPeakLoad,
+        paramSaveTail,
+        paramThreadLatency,
         kParameterCount
     };
 
+    enum States {
+        stateRom,
+        stateSnapshot,
+        kStateCount
+    };
+
     BarrVerb();
+    ~BarrVerb();
+
+    // timing for every block, for a non-realtime thread to drain
+    LoadMeter &getLoadMeter() { return meter; }
 
    protected:
     const char *getLabel() const override { return "BarrVerb"; }
@@ -57,6 +68,7 @@ class BarrVerb : public Plugin {
     // Initialisation
     void initAudioPort(bool input, uint32_t index, AudioPort &port) override;
     void initParameter(uint32_t index, Parameter &parameter) override;
+    void initState(uint32_t index, State &state) override;
 
     void setParameterValue(uint32_t index, float value) override;
     float getParameterValue(uint32_t index) const override;
@@ -64,23 +76,55 @@ class BarrVerb : public Plugin {
     void initProgramName(uint32_t index, String &programName) override;
     void loadProgram(uint32_t index) override;
 
+    String getState(const char *key) const override;
+    void setState(const char *key, const char *value) override;
+
     // Processing
+    void sampleRateChanged(double newSampleRate) override;
     void activate() override;
     void deactivate() override;
     void run(const float **inputs, float **outputs, uint32_t frames) override;
 
    private:
-    // float c1_1, c2_1, d0_1, c1_2, c2_2, d0_2, in_z1, in_z2, in_z12,in_z22, out_z1, out_z2;
-    SVF f1, f2;
-
-    int16_t ai = 0, li = 0, acc = 0;
-    uint16_t ptr = 0;
-    uint16_t prog_offset;
-
-    int16_t *ram;
-    float *lowpass;
-
-    uint8_t program;
+    void loadRom(String path);
+    void programChanged();
+
+    // everything that touches the engine, on whichever thread runs it
+    void process(const float *inL, const float *inR, float *outL, float *outR, uint32_t frames);
+    static void processThread(void *ctx, const float *inL, const float *inR, float *outL, float *outR,
+                              uint32_t frames);
+
+    BarrEngine engine;
+    LoadMeter meter;
+    SleepGate gate;
+    TelemetryWriter telemetry;
+    std::atomic<bool> asleep{false};  // the gate's, for whichever thread isn't running the engine
+
+    // with a thread latency set, the engine runs on engine_thread instead
+    // of in the host's callback
+    EngineThread engine_thread{processThread, this};
+    uint32_t thread_latency = 0;  // ms
+
+    // ROM images are decoded on rom_loader and swapped in at the top of run()
+    Handoff<const RomImage> rom_handoff{romFree};
+    const RomImage *rom_current;
+    std::thread rom_loader;
+    String rom_path;
+
+    // Engine snapshots are restored through the same kind of handoff, and
+    // captured by the audio thread at the end of run() when asked for, which
+    // posts capture_ready once capture_buf has been filled in
+    // If run() isn't being called, getState() falls back on the last one
+    Handoff<EngineSnapshot> snap_handoff{disposeSnapshot};
+    static void disposeSnapshot(EngineSnapshot *snap) { delete snap; }
+    EngineSnapshot *capture_buf;
+    mutable std::atomic<bool> capture_requested{false};
+    mutable Semaphore capture_ready;
+    mutable String last_snapshot;
+    bool save_tail = false;
+
+    // set from any thread, the engine picks it up at the start of a block
+    std::atomic<uint8_t> program{20};
 
     DISTRHO_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(BarrVerb);
 };
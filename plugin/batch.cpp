@@ -0,0 +1,232 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "batch.hpp"
+
+#include <string.h>
+
+#include "denormals.hpp"
+
+EngineBatch::EngineBatch() {
+    image = romBuiltin();
+    kern = kernelsSelect();
+}
+
+EngineBatch::~EngineBatch() {
+    deactivate();
+}
+
+bool EngineBatch::activate() {
+    if (!st) st = (BatchState *)arenaMap(sizeof(BatchState));
+    if (!st) return false;
+
+    reset();
+    return true;
+}
+
+void EngineBatch::deactivate() {
+    arenaUnmap(st, sizeof(BatchState));
+    st = nullptr;
+}
+
+void EngineBatch::setSampleRate(float rate) {
+    sample_rate = rate;
+    if (!st) return;
+
+    for (uint32_t l = 0; l < kLanes; l++) cascadeDesign(st->filter[l], rate);
+}
+
+void EngineBatch::setProgram(uint8_t index) {
+    program = index & 0x3f;
+    prog_offset = program << 7;
+}
+
+void EngineBatch::setRom(const RomImage *rom) {
+    image = rom;
+}
+
+void EngineBatch::reset() {
+    if (!st) return;
+
+    memset(st, 0, sizeof(BatchState));
+    setSampleRate(sample_rate);
+}
+
+void EngineBatch::captureLane(uint32_t lane, EngineSnapshot &snap) const {
+    if (!st || lane >= kLanes) return;
+
+    for (uint32_t i = 0; i < kRamWords; i++) snap.ram[i] = st->ram[i][lane];
+    memcpy(snap.filter, st->filter[lane].s, sizeof(snap.filter));
+    memcpy(snap.filter_in, st->filter[lane].u, sizeof(snap.filter_in));
+    snap.filter_fill = st->filter[lane].fill;
+    snap.acc = st->acc[lane];
+    snap.ptr = st->ptr;
+    snap.phase = st->phase;
+    snap.held_l = st->held_l[lane];
+    snap.held_r = st->held_r[lane];
+}
+
+void EngineBatch::applyLane(uint32_t lane, const EngineSnapshot &snap) {
+    if (!st || lane >= kLanes) return;
+
+    // whatever was at the snapshot's pointer goes at ours
+    uint16_t shift = st->ptr - snap.ptr;
+    for (uint32_t i = 0; i < kRamWords; i++) st->ram[(i + shift) & (kRamWords - 1)][lane] = snap.ram[i];
+    memcpy(st->filter[lane].s, snap.filter, sizeof(snap.filter));
+    memcpy(st->filter[lane].u, snap.filter_in, sizeof(snap.filter_in));
+    st->filter[lane].fill = snap.filter_fill % Cascade::kSteps;
+    st->acc[lane] = snap.acc;
+    st->held_l[lane] = snap.held_l;
+    st->held_r[lane] = snap.held_r;
+}
+
+void EngineBatch::clearLane(uint32_t lane) {
+    if (!st || lane >= kLanes) return;
+
+    for (uint32_t i = 0; i < kRamWords; i++) st->ram[i][lane] = 0;
+    memset(st->filter[lane].s, 0, sizeof(st->filter[lane].s));
+    memset(st->filter[lane].u, 0, sizeof(st->filter[lane].u));
+    st->filter[lane].fill = 0;
+    st->acc[lane] = 0;
+    st->held_l[lane] = st->held_r[lane] = 0;
+}
+
+void EngineBatch::setPhase(uint8_t phase) {
+    if (st) st->phase = phase & 1;
+}
+
+// The same as BarrEngine::process(), with every register but the pointer
+// widened to a lane each
+// The lane loops have a fixed count, so the compiler turns each into a
+// single vector operation
+void EngineBatch::process(uint32_t frames) {
+    const uint32_t L = kLanes;
+    const uint16_t *code = image->words + prog_offset;
+    int16_t ai[L], li[L], a[L];
+    uint16_t p = st->ptr;
+    uint16_t opcode;
+
+    for (uint32_t l = 0; l < L; l++) {
+        ai[l] = li[l] = 0;
+        a[l] = st->acc[l];
+    }
+
+    for (uint32_t i = 0; i < frames; i++) {
+        if (st->phase == 0) {
+            for (uint8_t step = 0; step < 128; step++) {
+                opcode = code[step];
+                int16_t *cell = st->ram[p];
+
+                switch (opcode & 0xc000) {
+                    case 0x0000:
+                        for (uint32_t l = 0; l < L; l++) {
+                            ai[l] = cell[l];
+                            li[l] = a[l] + (ai[l] >> 1);
+                        }
+                        break;
+                    case 0x4000:
+                        for (uint32_t l = 0; l < L; l++) {
+                            ai[l] = cell[l];
+                            li[l] = (ai[l] >> 1);
+                        }
+                        break;
+                    case 0x8000:
+                        for (uint32_t l = 0; l < L; l++) {
+                            ai[l] = a[l];
+                            cell[l] = ai[l];
+                            li[l] = a[l] + (ai[l] >> 1);
+                        }
+                        break;
+                    case 0xc000:
+                        for (uint32_t l = 0; l < L; l++) {
+                            ai[l] = a[l];
+                            cell[l] = -ai[l];
+                            li[l] = -(ai[l] >> 1);
+                        }
+                        break;
+                }
+
+                // clamp
+                for (uint32_t l = 0; l < L; l++) {
+                    if (ai[l] > 2047) ai[l] = 2047;
+                    if (ai[l] < -2047) ai[l] = -2047;
+                }
+
+                if (step == 0x00) {
+                    // load RAM from ADC
+                    for (uint32_t l = 0; l < L; l++) cell[l] = (int)(st->lowpass[l][i] * 2048);
+                } else if (step == 0x60) {
+                    // output right channel
+                    for (uint32_t l = 0; l < L; l++) st->held_r[l] = ai[l];
+                } else if (step == 0x70) {
+                    // output left channel
+                    for (uint32_t l = 0; l < L; l++) st->held_l[l] = ai[l];
+                } else {
+                    // ADC and DAC operations don't affect the accumulator
+                    for (uint32_t l = 0; l < L; l++) a[l] = li[l];
+                }
+
+                // 16kW of RAM
+                p += opcode & 0x3fff;
+                p &= kRamWords - 1;
+            }
+        }
+        // the DACs hold their value for the odd sample
+        for (uint32_t l = 0; l < L; l++) {
+            st->dac_l[l][i] = st->held_l[l];
+            st->dac_r[l][i] = st->held_r[l];
+        }
+        st->phase ^= 1;
+    }
+
+    for (uint32_t l = 0; l < L; l++) st->acc[l] = a[l];
+    st->ptr = p;
+}
+
+void EngineBatch::run(const float *const *inL, const float *const *inR, float *const *outL,
+                      float *const *outR, uint32_t lanes, uint32_t frames) {
+    if (lanes > kLanes) lanes = kLanes;
+    if (!st) {
+        for (uint32_t l = 0; l < lanes; l++) {
+            if (outL[l]) memset(outL[l], 0, sizeof(float) * frames);
+            if (outR[l]) memset(outR[l], 0, sizeof(float) * frames);
+        }
+        return;
+    }
+    ScopedDenormals ftz;
+
+    for (uint32_t done = 0; done < frames;) {
+        uint32_t n = frames - done < kBlockSize ? frames - done : kBlockSize;
+
+        for (uint32_t l = 0; l < kLanes; l++) {
+            if (l < lanes && inL[l] && inR[l]) {
+                kern->mixFloat(inL[l] + done, inR[l] + done, st->lowpass[l], n);
+            } else {
+                memset(st->lowpass[l], 0, sizeof(float) * n);
+            }
+            // a lane in use rings out through its filters like any other input
+            if (l < lanes) kern->cascade(st->filter[l], st->lowpass[l], n);
+        }
+        process(n);
+        for (uint32_t l = 0; l < lanes; l++) {
+            if (outL[l] && outR[l]) kern->dacToFloat(st->dac_l[l], st->dac_r[l], outL[l] + done, outR[l] + done, n);
+        }
+
+        done += n;
+    }
+}
@@ -0,0 +1,111 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_BATCH_HPP
+#define BARRVERB_BATCH_HPP
+
+#include <stdint.h>
+
+#include "arena.hpp"
+#include "cascade.hpp"
+#include "kernels.hpp"
+#include "romimage.hpp"
+#include "snapshot.hpp"
+
+// Several engines running the same program, one to a SIMD lane
+// The program only ever addresses RAM relative to the pointer register, and
+// the pointer only depends on the program, so every lane reads and writes the
+// same address at every step
+// RAM is interleaved by lane, so each step is one vector load or store across
+// all the lanes, and one pass through the microcode does all of them
+struct BatchState {
+    static const uint32_t kLanes = 8;
+    static const uint32_t kBlockSize = 256;
+
+    int16_t ram[kRamWords][kLanes];
+
+    float lowpass[kLanes][kBlockSize];
+    int16_t dac_l[kLanes][kBlockSize];
+    int16_t dac_r[kLanes][kBlockSize];
+
+    Cascade filter[kLanes];
+
+    int16_t acc[kLanes];
+    int16_t held_l[kLanes], held_r[kLanes];
+    uint16_t ptr;
+    uint8_t phase;
+};
+
+// Each lane is a complete engine with its own input and output, the same as
+// a BarrEngine would give on the same input, but the program is shared
+class EngineBatch {
+   public:
+    static const uint32_t kLanes = BatchState::kLanes;
+    static const uint32_t kBlockSize = BatchState::kBlockSize;
+
+    EngineBatch();
+    ~EngineBatch();
+
+    // the state is 300kB or so, too big for the arena's blocks, so it's
+    // mapped on activate() and unmapped on deactivate()
+    bool activate();
+    void deactivate();
+    bool isActive() const { return st != nullptr; }
+
+    void setSampleRate(float rate);
+    void setProgram(uint8_t program);  // 0 to 63
+    void setRom(const RomImage *image);  // not copied, must outlive its use
+    uint8_t getProgram() const { return program; }
+    void reset();
+
+    // Moving engines between batches, one lane at a time
+    // The RAM is turned round to line up with this batch's pointer on the
+    // way in, which is all it takes since the programs only address RAM
+    // relative to it, but the phase isn't, so a lane should only go into a
+    // batch that's on the same sample as the one it came from
+    void captureLane(uint32_t lane, EngineSnapshot &snap) const;
+    void applyLane(uint32_t lane, const EngineSnapshot &snap);
+    void clearLane(uint32_t lane);  // as if it had just been reset
+    // for a batch with no lanes in use, to line it up with the lanes going in
+    void setPhase(uint8_t phase);
+
+    // lane n takes inL[n] and inR[n] summed to mono and writes outL[n] and
+    // outR[n], for the first lanes lanes, the rest are fed silence straight
+    // into the program, skipping their filters, since they aren't in use
+    // A lane with null inputs is fed silence through its filters, just as a
+    // BarrEngine fed zeroes is, and one with null outputs runs but isn't
+    // written out
+    void run(const float *const *inL, const float *const *inR, float *const *outL, float *const *outR,
+             uint32_t lanes, uint32_t frames);
+
+   private:
+    EngineBatch(const EngineBatch &) = delete;
+    EngineBatch &operator=(const EngineBatch &) = delete;
+
+    void process(uint32_t frames);
+
+    const RomImage *image;
+    const Kernels *kern;
+    float sample_rate = 48000;
+    uint16_t prog_offset = 0;
+    uint8_t program = 0;
+
+    BatchState *st = nullptr;
+};
+
+#endif  // BARRVERB_BATCH_HPP
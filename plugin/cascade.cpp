@@ -0,0 +1,148 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "cascade.hpp"
+
+#include <math.h>
+#include <string.h>
+
+/*
+
+SVF::SVF(float cutoff, float q, float samplerate) {
+    z1 = z2 = 0;
+    setFreq(cutoff, q, samplerate);
+}
+*/
+
+void SVF::setFreq(float cutoff, float q, float samplerate) {
+    //printf("called with %f %f %f\n", cutoff, q, samplerate);
+    w = 2 * tan(3.14159 * (cutoff / samplerate));
+    a = w / q;
+    b = w * w;
+
+    // corrected SVF params, per Fons Adriaensen
+    c1 = (a + b) / (1 + a / 2 + b / 4);
+    c2 = b / (a + b);
+
+    d0 = c1 * c2 / 4;
+
+    //printf("c1 %f c2 %f d0 %f\n", c1, c2, d0);
+}
+
+void SVF::reset() {
+    z1 = z2 = 0;
+}
+
+float SVF::lpStep(float in) {
+    x = in - z1 - z2;
+    z2 += c2 * z1;
+    z1 += c1 * x;
+    return d0 * x + z2;
+}
+
+void SVF::getState(float *z) const {
+    z[0] = z1;
+    z[1] = z2;
+}
+
+void SVF::setState(const float *z) {
+    z1 = z[0];
+    z2 = z[1];
+}
+
+// one sample of the plain cascade, from state s and input u
+// returns the output and leaves the next state in s
+static float step(SVF &f1, SVF &f2, double *s, double u) {
+    float z[4] = {(float)s[0], (float)s[1], (float)s[2], (float)s[3]};
+    f1.setState(z);
+    f2.setState(z + 2);
+    float y = f2.lpStep(f1.lpStep(u));
+    f1.getState(z);
+    f2.getState(z + 2);
+    for (int i = 0; i < 4; i++) s[i] = z[i];
+    return y;
+}
+
+void cascadeDesign(Cascade &c, float rate) {
+    const uint32_t N = Cascade::kSteps;
+    SVF f1, f2;
+    f1.setFreq(5916, .6572, rate);
+    f2.setFreq(9458, 2.536, rate);
+
+    // The cascade is linear, so one step is s' = A.s + B.u, y = C.s + D.u
+    // and stepping it from each unit state and a unit input gives the lot
+    double A[4][4], B[4], C[4], D;
+    for (int i = 0; i < 4; i++) {
+        double s[4] = {0, 0, 0, 0};
+        s[i] = 1;
+        C[i] = step(f1, f2, s, 0);
+        for (int r = 0; r < 4; r++) A[r][i] = s[r];
+    }
+    double s[4] = {0, 0, 0, 0};
+    D = step(f1, f2, s, 1);
+    for (int r = 0; r < 4; r++) B[r] = s[r];
+
+    // walk A^k forward, k = 0 to N
+    // output k sees the state through C.A^k, and input j through C.A^(k-j-1).B,
+    // or D when j = k
+    // at the end of the block the state is A^N.s plus A^(N-j-1).B for each input
+    double P[4][4], CAkB[N];
+    memset(P, 0, sizeof(P));
+    for (int i = 0; i < 4; i++) P[i][i] = 1;
+
+    for (uint32_t k = 0; k <= N; k++) {
+        if (k < N) {
+            // C.A^k
+            for (int i = 0; i < 4; i++) {
+                double v = 0;
+                for (int r = 0; r < 4; r++) v += C[r] * P[r][i];
+                c.ys[i][k] = v;
+            }
+            // C.A^k.B, and A^k.B for the input that's k from the end
+            double v = 0, AkB[4];
+            for (int r = 0; r < 4; r++) {
+                AkB[r] = 0;
+                for (int i = 0; i < 4; i++) AkB[r] += P[r][i] * B[i];
+                v += C[r] * AkB[r];
+            }
+            CAkB[k] = v;
+            for (int r = 0; r < 4; r++) c.su[N - 1 - k][r] = AkB[r];
+        } else {
+            for (int i = 0; i < 4; i++)
+                for (int r = 0; r < 4; r++) c.ss[i][r] = P[r][i];
+        }
+
+        // P = A.P
+        double next[4][4];
+        for (int r = 0; r < 4; r++) {
+            for (int i = 0; i < 4; i++) {
+                next[r][i] = 0;
+                for (int m = 0; m < 4; m++) next[r][i] += A[r][m] * P[m][i];
+            }
+        }
+        memcpy(P, next, sizeof(P));
+    }
+
+    for (uint32_t j = 0; j < N; j++) {
+        for (uint32_t k = 0; k < N; k++) {
+            if (k < j) c.yu[j][k] = 0;
+            else if (k == j) c.yu[j][k] = D;
+            else c.yu[j][k] = CAkB[k - j - 1];
+        }
+    }
+}
@@ -0,0 +1,66 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_CASCADE_HPP
+#define BARRVERB_CASCADE_HPP
+
+#include <stdint.h>
+
+class SVF {
+   public:
+    //SVF(float cutoff, float q, float samplerate);
+    void setFreq(float cutoff, float q, float samplerate);  // leaves the state alone
+    void reset();
+    float lpStep(float in);
+
+    // just the integrator states, without the coefficients
+    void getState(float *z) const;
+    void setState(const float *z);
+
+   private:
+    float w, a, b;
+    float c1, c2, d0;
+    float z1 = 0, z2 = 0, x;
+};
+
+// The two input filter stages, run as one fourth-order state-space system
+// eight samples at a time
+// Every output in a block is worked out directly from the state at the start
+// of the block and the inputs so far, so there's no sample-to-sample dependency
+// and the compiler can do all eight at once
+// A short run() keeps its inputs and picks up where it left off, so the result
+// doesn't depend on how the audio was chunked
+struct Cascade {
+    static const uint32_t kSteps = 8;
+
+    // coefficients, laid out so the innermost loops run across the block
+    float ys[4][kSteps];       // output k from state i, ys[i][k]
+    float yu[kSteps][kSteps];  // output k from input j, yu[j][k], zero where j > k
+    float ss[4][4];            // state r at the end of the block from state i, ss[i][r]
+    float su[kSteps][4];       // state r at the end of the block from input j, su[j][r]
+
+    // state
+    float s[4];       // z1 and z2 of each stage at the start of the block
+    float u[kSteps];  // inputs of a part-finished block
+    uint32_t fill;    // how many of them there are
+};
+
+// Work out the block coefficients for a sample rate, keeping the filter state
+void cascadeDesign(Cascade &c, float rate);
+
+#endif  // BARRVERB_CASCADE_HPP
@@ -0,0 +1,63 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_DENORMALS_HPP
+#define BARRVERB_DENORMALS_HPP
+
+#include <stdint.h>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define DENORMALS_SSE 1
+#endif
+
+// Flush denormals to zero for as long as this is in scope, and put the
+// floating point mode back how the host had it afterwards
+// A reverb tail decaying towards silence goes through the denormal range on
+// its way out, and some CPUs take a hundred times longer over those
+class ScopedDenormals {
+   public:
+    ScopedDenormals() {
+#if defined(DENORMALS_SSE)
+        saved = _mm_getcsr();
+        _mm_setcsr(saved | 0x8040);  // FTZ and DAZ
+#elif defined(__aarch64__)
+        uint64_t fpcr;
+        __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+        saved = fpcr;
+        __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr | (1 << 24)));  // FZ
+#endif
+    }
+
+    ~ScopedDenormals() {
+#if defined(DENORMALS_SSE)
+        _mm_setcsr(saved);
+#elif defined(__aarch64__)
+        uint64_t fpcr = saved;
+        __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr));
+#endif
+    }
+
+   private:
+    ScopedDenormals(const ScopedDenormals &) = delete;
+    ScopedDenormals &operator=(const ScopedDenormals &) = delete;
+
+    uint64_t saved = 0;
+};
+
+#endif  // BARRVERB_DENORMALS_HPP
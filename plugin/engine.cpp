@@ -0,0 +1,600 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "engine.hpp"
+
+#include "arena.hpp"
+#include "denormals.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+static_assert(sizeof(EngineState) <= kArenaBlockSize, "engine state doesn't fit in an arena block");
+
+// The family kernels
+// Each one is the loop in process() with the 128 steps unrolled, and the
+// kind of every step fixed where its family agrees, which leaves the switch,
+// the step number tests and the loop counter to the compiler to get rid of
+// There are only a few, so that they stay in the instruction cache with lots
+// of instances running different programs
+// The profiling builds need the hooks in process(), so they do without, and
+// so do BARRVERB_PLAIN builds, which tools/enginecheck checks the others with
+
+#if !defined(BARRVERB_COUNTERS) && !defined(BARRVERB_TRACE) && !defined(BARRVERB_PLAIN)
+#define BARRVERB_FAMILIES 1
+
+#ifdef __GNUC__
+#define FAMILY_INLINE inline __attribute__((always_inline))
+#else
+#define FAMILY_INLINE inline
+#endif
+
+// one step of process(), kind is -1 where it comes from the ROM word
+template <int kind, uint32_t step>
+static FAMILY_INLINE void familyStep(const uint16_t *code, int16_t *ram, uint16_t &p, int16_t &a, float in,
+                                     int16_t &held_l, int16_t &held_r) {
+    uint16_t opcode = code[step];
+    int16_t ai = 0, li = 0;
+
+    switch (kind < 0 ? opcode >> 14 : kind) {
+        case 0:
+            ai = ram[p];
+            li = a + (ai >> 1);
+            break;
+        case 1:
+            ai = ram[p];
+            li = (ai >> 1);
+            break;
+        case 2:
+            ai = a;
+            ram[p] = ai;
+            li = a + (ai >> 1);
+            break;
+        case 3:
+            ai = a;
+            ram[p] = -ai;
+            li = -(ai >> 1);
+            break;
+    }
+
+    if (ai > 2047) ai = 2047;
+    if (ai < -2047) ai = -2047;
+
+    if (step == 0x00) {
+        ram[p] = (int)(in * 2048);
+    } else if (step == 0x60) {
+        held_r = ai;
+    } else if (step == 0x70) {
+        held_l = ai;
+    } else {
+        a = li;
+    }
+
+    p += opcode & 0x3fff;
+    p &= kRamWords - 1;
+}
+
+#define FAMILY_STEP(step, kind) familyStep<kind, step>(code, ram, p, a, in, held_l, held_r);
+#define FAMILY_ANY(step) familyStep<-1, step>(code, ram, p, a, in, held_l, held_r);
+
+#define FAMILY_KERNEL(name, steps)                                              \
+    static void name(EngineState *st, const uint16_t *code, uint32_t frames) { \
+        int16_t *ram = st->ram;                                                 \
+        int16_t a = st->acc, held_l = st->held_l, held_r = st->held_r;         \
+        uint16_t p = st->ptr;                                                   \
+        uint8_t phase = st->phase;                                              \
+                                                                                \
+        for (uint32_t i = 0; i < frames; i++) {                                 \
+            if (phase == 0) {                                                   \
+                const float in = st->lowpass[i];                                \
+                steps                                                           \
+            }                                                                   \
+            st->dac_l[i] = held_l;                                              \
+            st->dac_r[i] = held_r;                                              \
+            phase ^= 1;                                                         \
+        }                                                                       \
+                                                                                \
+        st->acc = a;                                                            \
+        st->ptr = p;                                                            \
+        st->phase = phase;                                                      \
+        st->held_l = held_l;                                                    \
+        st->held_r = held_r;                                                    \
+    }
+
+#include "families.h"
+#endif
+
+// The threaded interpreter
+// Programs without a family kernel, which includes most from a loaded ROM,
+// are translated into a list of handlers when the program or ROM changes,
+// with the ADC and DAC steps picked out ahead of time, so that each step
+// is a jump to code that does just that step
+// GCC and Clang go straight from one handler to the next with computed
+// goto, anything else gets a switch in a loop
+
+#ifdef BARRVERB_FAMILIES
+#define BARRVERB_THREADED 1
+#if defined(__GNUC__) && !defined(BARRVERB_NO_COMPUTED_GOTO)
+#define BARRVERB_COMPUTED_GOTO 1
+#endif
+#endif
+
+// the opcode kind times four, plus which of these the step is
+enum ThreadedRole {
+    threadedPlain,
+    threadedAdc,
+    threadedRight,
+    threadedLeft,
+};
+static const uint32_t kThreadedEnd = 16;
+
+// the four kinds of step, as in process()
+#define THREADED_READ_0 \
+    ai = ram[p];        \
+    li = a + (ai >> 1);
+#define THREADED_READ_1 \
+    ai = ram[p];        \
+    li = (ai >> 1);
+#define THREADED_READ_2 \
+    ai = a;             \
+    ram[p] = ai;        \
+    li = a + (ai >> 1);
+#define THREADED_READ_3 \
+    ai = a;             \
+    ram[p] = -ai;       \
+    li = -(ai >> 1);
+
+#define THREADED_CLAMP           \
+    if (ai > 2047) ai = 2047;    \
+    if (ai < -2047) ai = -2047;
+
+#ifdef BARRVERB_COMPUTED_GOTO
+#define THREADED_DISPATCH goto *handlers[t & 0xff];
+#define THREADED_OP(n) op##n:
+#define THREADED_NEXT                      \
+    p = (p + (t >> 8)) & (kRamWords - 1); \
+    t = *++ip;                             \
+    goto *handlers[t & 0xff];
+#else
+#define THREADED_DISPATCH \
+    for (;;) switch (t & 0xff)
+#define THREADED_OP(n) case n:
+#define THREADED_NEXT                      \
+    p = (p + (t >> 8)) & (kRamWords - 1); \
+    t = *++ip;                             \
+    continue;
+#endif
+
+#define THREADED_KIND(kind, plain, adc, right, left) \
+    THREADED_OP(plain)                               \
+    THREADED_READ_##kind a = li;                     \
+    THREADED_NEXT                                    \
+    THREADED_OP(adc)                                 \
+    THREADED_READ_##kind ram[p] = (int)(in * 2048);  \
+    THREADED_NEXT                                    \
+    THREADED_OP(right)                               \
+    THREADED_READ_##kind THREADED_CLAMP held_r = ai; \
+    THREADED_NEXT                                    \
+    THREADED_OP(left)                                \
+    THREADED_READ_##kind THREADED_CLAMP held_l = ai; \
+    THREADED_NEXT
+
+BarrEngine::BarrEngine() {
+    image = romBuiltin();
+    kern = kernelsSelect();
+    prepareProgram();
+#ifdef BARRVERB_COUNTERS
+    counters = new EngineCounters;
+    resetCounters();
+#endif
+}
+
+BarrEngine::~BarrEngine() {
+    deactivate();
+#ifdef BARRVERB_COUNTERS
+    delete counters;
+#endif
+#ifdef BARRVERB_TRACE
+    setTrace(nullptr);
+#endif
+}
+
+#ifdef BARRVERB_COUNTERS
+void BarrEngine::resetCounters() {
+    memset(counters, 0, sizeof(EngineCounters));
+}
+#endif
+
+#ifdef BARRVERB_TRACE
+void BarrEngine::setTrace(FILE *file) {
+    flushTrace();
+    trace = file;
+    if (trace) fwrite("BARRTRC1", 1, 8, trace);
+}
+
+void BarrEngine::flushTrace() {
+    if (trace && trace_used) fwrite(trace_buf, sizeof(uint16_t) * 129, trace_used, trace);
+    trace_used = 0;
+}
+#endif
+
+bool BarrEngine::activate() {
+    if (!st) st = (EngineState *)arenaAcquire();
+    if (!st) return false;
+
+    reset();
+    return true;
+}
+
+void BarrEngine::deactivate() {
+    arenaRelease(st);
+    st = nullptr;
+}
+
+void BarrEngine::setSampleRate(float rate) {
+    sample_rate = rate;
+    if (!st) return;
+
+    cascadeDesign(st->filter, rate);
+}
+
+void BarrEngine::setProgram(uint8_t index) {
+    program = index & 0x3f;
+    prog_offset = program << 7;
+    prepareProgram();
+}
+
+void BarrEngine::setRom(const RomImage *rom) {
+    image = rom;
+    prepareProgram();
+}
+
+void BarrEngine::setKernels(const Kernels *kernels) {
+    kern = kernels;
+}
+
+void BarrEngine::setFamilies(bool enable) {
+    use_families = enable;
+    prepareProgram();
+}
+
+// the first family kernel that the program fits, matched on the words
+// themselves so that it works for any ROM, or failing that the program
+// translated for the threaded interpreter
+void BarrEngine::prepareProgram() {
+    family = nullptr;
+#ifdef BARRVERB_FAMILIES
+    const uint16_t *code = image->words + prog_offset;
+    for (size_t f = 0; use_families && f < sizeof(::families) / sizeof(::families[0]); f++) {
+        const char *kinds = ::families[f].kinds;
+        uint32_t step = 0;
+        while (step < 128 && (kinds[step] == 'x' || kinds[step] - '0' == code[step] >> 14)) step++;
+        if (step == 128) {
+            family = ::families[f].kernel;
+            return;
+        }
+    }
+
+    for (uint32_t step = 0; step < 128; step++) {
+        uint32_t role = threadedPlain;
+        if (step == 0x00) role = threadedAdc;
+        if (step == 0x60) role = threadedRight;
+        if (step == 0x70) role = threadedLeft;
+        threaded[step] = ((code[step] >> 14) << 2 | role) | (code[step] & 0x3fff) << 8;
+    }
+    threaded[128] = kThreadedEnd;
+#endif
+}
+
+void BarrEngine::reset() {
+    if (!st) return;
+
+    memset(st, 0, sizeof(EngineState));
+    setSampleRate(sample_rate);
+}
+
+void BarrEngine::capture(EngineSnapshot &snap) const {
+    if (!st) return;
+
+    memcpy(snap.ram, st->ram, kRamBytes);
+    memcpy(snap.filter, st->filter.s, sizeof(snap.filter));
+    memcpy(snap.filter_in, st->filter.u, sizeof(snap.filter_in));
+    snap.filter_fill = st->filter.fill;
+    snap.acc = st->acc;
+    snap.ptr = st->ptr;
+    snap.phase = st->phase;
+    snap.held_l = st->held_l;
+    snap.held_r = st->held_r;
+}
+
+void BarrEngine::apply(const EngineSnapshot &snap) {
+    if (!st) return;
+
+    memcpy(st->ram, snap.ram, kRamBytes);
+    memcpy(st->filter.s, snap.filter, sizeof(snap.filter));
+    memcpy(st->filter.u, snap.filter_in, sizeof(snap.filter_in));
+    st->filter.fill = snap.filter_fill % Cascade::kSteps;
+    st->acc = snap.acc;
+    st->ptr = snap.ptr;
+    st->phase = snap.phase;
+    st->held_l = snap.held_l;
+    st->held_r = snap.held_r;
+}
+
+bool BarrEngine::silence(float *outL, float *outR, uint32_t frames) {
+    if (st) return false;
+
+    // not active, so there's nothing to run the program on
+    memset(outL, 0, sizeof(float) * frames);
+    memset(outR, 0, sizeof(float) * frames);
+    return true;
+}
+
+void BarrEngine::filter(uint32_t frames) {
+    kern->cascade(st->filter, st->lowpass, frames);
+}
+
+void BarrEngine::process(uint32_t frames) {
+    if (family) {
+        family(st, image->words + prog_offset, frames);
+        return;
+    }
+#ifdef BARRVERB_THREADED
+    runThreaded(frames);
+    return;
+#endif
+
+    // what's left is for the profiling and plain builds
+
+    // keep the registers local for the duration of the chunk
+    const uint16_t *code = image->words + prog_offset;
+    int16_t *ram = st->ram;
+    const float *lowpass = st->lowpass;
+    int16_t ai = 0, li = 0;
+    int16_t a = st->acc;
+    uint16_t p = st->ptr;
+    uint16_t opcode;
+
+    for (uint32_t i = 0; i < frames; i++) {
+        if (st->phase == 0) {
+#ifdef BARRVERB_TRACE
+            uint16_t *record = trace_buf + trace_used * 129;
+            record[0] = program;
+#endif
+            // run the actual DSP engine for each sample
+            for (uint8_t step = 0; step < 128; step++) {
+                opcode = code[step];
+#ifdef BARRVERB_TRACE
+                record[step + 1] = (opcode & 0xc000) | p;
+#endif
+                switch (opcode & 0xc000) {
+                    case 0x0000:
+                        ai = ram[p];
+                        li = a + (ai >> 1);
+                        break;
+                    case 0x4000:
+                        ai = ram[p];
+                        li = (ai >> 1);
+                        break;
+                    case 0x8000:
+                        ai = a;
+                        ram[p] = ai;
+                        li = a + (ai >> 1);
+                        break;
+                    case 0xc000:
+                        ai = a;
+                        ram[p] = -ai;
+                        li = -(ai >> 1);
+                        break;
+                }
+
+                // clamp
+#ifdef BARRVERB_COUNTERS
+                if (ai > 2047 || ai < -2047) counters->clamps[program][step]++;
+#endif
+                if (ai > 2047) ai = 2047;
+                if (ai < -2047) ai = -2047;
+
+                if (step == 0x00) {
+                    // load RAM from ADC
+                    ram[p] = (int)(lowpass[i] * 2048);
+                } else if (step == 0x60) {
+                    // output right channel
+                    st->held_r = ai;
+#ifdef BARRVERB_COUNTERS
+                    if (abs(ai) > counters->peak_r) counters->peak_r = abs(ai);
+#endif
+                } else if (step == 0x70) {
+                    // output left channel
+                    st->held_l = ai;
+#ifdef BARRVERB_COUNTERS
+                    if (abs(ai) > counters->peak_l) counters->peak_l = abs(ai);
+#endif
+                } else {
+                    // everything else
+                    // ADC and DAC operations don't affect the accumulator
+                    // every other step ends with the accumulator latched from the Latch Input reg
+                    a = li;
+                }
+
+                // 16kW of RAM
+                p += opcode & 0x3fff;
+                p &= kRamWords - 1;
+            }
+#ifdef BARRVERB_TRACE
+            if (trace && ++trace_used == kTraceRecords) flushTrace();
+#endif
+        }
+        // the DACs hold their value for the odd sample
+        st->dac_l[i] = st->held_l;
+        st->dac_r[i] = st->held_r;
+        st->phase ^= 1;
+    }
+
+    st->acc = a;
+    st->ptr = p;
+}
+
+void BarrEngine::runThreaded(uint32_t frames) {
+#ifdef BARRVERB_THREADED
+#ifdef BARRVERB_COMPUTED_GOTO
+    static const void *const handlers[] = {
+        &&op0, &&op1, &&op2,  &&op3,  &&op4,  &&op5,  &&op6,  &&op7,  &&op8,
+        &&op9, &&op10, &&op11, &&op12, &&op13, &&op14, &&op15, &&op16,
+    };
+#endif
+    int16_t *ram = st->ram;
+    int16_t a = st->acc, held_l = st->held_l, held_r = st->held_r;
+    int16_t ai, li;
+    uint16_t p = st->ptr;
+    uint8_t phase = st->phase;
+
+    for (uint32_t i = 0; i < frames; i++) {
+        if (phase == 0) {
+            const float in = st->lowpass[i];
+            const uint32_t *ip = threaded;
+            uint32_t t = *ip;
+
+            THREADED_DISPATCH {
+                THREADED_KIND(0, 0, 1, 2, 3)
+                THREADED_KIND(1, 4, 5, 6, 7)
+                THREADED_KIND(2, 8, 9, 10, 11)
+                THREADED_KIND(3, 12, 13, 14, 15)
+                THREADED_OP(16)
+                goto done;
+            }
+        done:;
+        }
+        st->dac_l[i] = held_l;
+        st->dac_r[i] = held_r;
+        phase ^= 1;
+    }
+
+    st->acc = a;
+    st->ptr = p;
+    st->phase = phase;
+    st->held_l = held_l;
+    st->held_r = held_r;
+#else
+    (void)frames;
+#endif
+}
+
+void BarrEngine::run(const float *inL, const float *inR, float *outL, float *outR, uint32_t frames) {
+    if (silence(outL, outR, frames)) return;
+    ScopedDenormals ftz;
+
+    while (frames) {
+        uint32_t n = frames < kBlockSize ? frames : kBlockSize;
+
+        kern->mixFloat(inL, inR, st->lowpass, n);
+        filter(n);
+        process(n);
+        kern->dacToFloat(st->dac_l, st->dac_r, outL, outR, n);
+
+        inL += n;
+        inR += n;
+        outL += n;
+        outR += n;
+        frames -= n;
+    }
+}
+
+void BarrEngine::runPrefiltered(const float *in, float *outL, float *outR, uint32_t frames) {
+    if (silence(outL, outR, frames)) return;
+    ScopedDenormals ftz;
+
+    while (frames) {
+        uint32_t n = frames < kBlockSize ? frames : kBlockSize;
+
+        memcpy(st->lowpass, in, sizeof(float) * n);
+        process(n);
+        kern->dacToFloat(st->dac_l, st->dac_r, outL, outR, n);
+
+        in += n;
+        outL += n;
+        outR += n;
+        frames -= n;
+    }
+}
+
+// The integer paths convert straight into the filter's input and straight
+// out of the DAC words, see kernels.cpp
+
+void BarrEngine::runInt16(const int16_t *in, uint32_t channels, int16_t *out, uint32_t frames) {
+    if (!st || !channels) {
+        memset(out, 0, sizeof(int16_t) * 2 * frames);
+        return;
+    }
+    ScopedDenormals ftz;
+
+    while (frames) {
+        uint32_t n = frames < kBlockSize ? frames : kBlockSize;
+
+        kern->int16In(in, channels, st->lowpass, n);
+        filter(n);
+        process(n);
+        kern->int16Out(st->dac_l, st->dac_r, out, n);
+
+        in += n * channels;
+        out += n * 2;
+        frames -= n;
+    }
+}
+
+void BarrEngine::runInt24(const uint8_t *in, uint32_t channels, uint8_t *out, uint32_t frames) {
+    if (!st || !channels) {
+        memset(out, 0, sizeof(uint8_t) * 6 * frames);
+        return;
+    }
+    ScopedDenormals ftz;
+
+    while (frames) {
+        uint32_t n = frames < kBlockSize ? frames : kBlockSize;
+
+        kern->int24In(in, channels, st->lowpass, n);
+        filter(n);
+        process(n);
+        kern->int24Out(st->dac_l, st->dac_r, out, n);
+
+        in += 3 * n * channels;
+        out += 6 * n;
+        frames -= n;
+    }
+}
+
+void BarrEngine::runInt32(const int32_t *in, uint32_t channels, int32_t *out, uint32_t frames) {
+    if (!st || !channels) {
+        memset(out, 0, sizeof(int32_t) * 2 * frames);
+        return;
+    }
+    ScopedDenormals ftz;
+
+    while (frames) {
+        uint32_t n = frames < kBlockSize ? frames : kBlockSize;
+
+        kern->int32In(in, channels, st->lowpass, n);
+        filter(n);
+        process(n);
+        kern->int32Out(st->dac_l, st->dac_r, out, n);
+
+        in += n * channels;
+        out += n * 2;
+        frames -= n;
+    }
+}
@@ -0,0 +1,176 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_ENGINE_HPP
+#define BARRVERB_ENGINE_HPP
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "arena.hpp"
+#include "cascade.hpp"
+#include "kernels.hpp"
+#include "romimage.hpp"
+#include "snapshot.hpp"
+
+// Everything the engine touches in run(), kept together in one arena block
+// so that none of it is faulted in or scattered across the heap
+struct EngineState {
+    // audio is processed in chunks of this many frames
+    static const uint32_t kBlockSize = 256;
+
+    int16_t ram[kRamWords];
+
+    // staging for one chunk
+    float lowpass[kBlockSize];
+    int16_t dac_l[kBlockSize];
+    int16_t dac_r[kBlockSize];
+
+    Cascade filter;
+
+    int16_t acc;
+    uint16_t ptr;
+    uint8_t phase;  // the DSP runs at half the sample rate
+    int16_t held_l, held_r;
+};
+
+// A kernel for one family of programs, see tools/romgen.cpp, and the kind
+// of each step that the programs it runs have to have, 0 to 3, or x for any
+typedef void (*FamilyKernel)(EngineState *st, const uint16_t *code, uint32_t frames);
+
+struct FamilyInfo {
+    FamilyKernel kernel;
+    const char *kinds;
+};
+
+#ifdef BARRVERB_COUNTERS
+// Profiling counters, only present when built with BARRVERB_COUNTERS
+struct EngineCounters {
+    uint32_t clamps[64][128];  // accumulator clamped at +/-2047, by program and step
+    int16_t peak_l, peak_r;    // largest DAC output seen
+};
+#endif
+
+// The MIDIVerb DSP itself, without any plugin framework attached
+// The engine works on 12-bit words internally, so the integer entry points
+// only convert on the way into the input filter and shift on the way out
+class BarrEngine {
+   public:
+    static const uint32_t kBlockSize = EngineState::kBlockSize;
+
+    BarrEngine();
+    ~BarrEngine();
+
+    // the delay RAM and everything else run() uses is only held while the
+    // engine is active, run() produces silence until activate() has been called
+    bool activate();
+    void deactivate();
+    bool isActive() const { return st != nullptr; }
+
+    // recalculates the input filters, but doesn't disturb them
+    void setSampleRate(float rate);
+    void setProgram(uint8_t program);  // 0 to 63
+    void setRom(const RomImage *image);  // not copied, must outlive its use
+    uint8_t getProgram() const { return program; }
+
+    // the conversion kernels are picked for the CPU when the engine is
+    // created, this overrides them, for testing
+    void setKernels(const Kernels *kernels);
+    const Kernels *getKernels() const { return kern; }
+
+    // programs that fit one of the family kernels run on it, the rest go
+    // through the threaded interpreter, and profiling and BARRVERB_PLAIN
+    // builds use the plain one for everything
+    // turning them off is for testing
+    void setFamilies(bool enable);
+    bool runsFamily() const { return family != nullptr; }
+    void reset();
+
+    // copy the running state out or back in, both safe to call from the
+    // audio thread, and both no-ops if the engine isn't active
+    void capture(EngineSnapshot &snap) const;
+    void apply(const EngineSnapshot &snap);
+
+    // All of these flush denormals to zero while they run
+    // planar float, left and right are summed to mono on the way in
+    void run(const float *inL, const float *inR, float *outL, float *outR, uint32_t frames);
+
+    // mono that has already been through the input filters, so that one
+    // filter can feed any number of engines
+    void runPrefiltered(const float *in, float *outL, float *outR, uint32_t frames);
+
+    // interleaved PCM, with any number of input channels summed to mono as
+    // run() does, and stereo output
+    // no input channels at all gives silence, as an inactive engine does
+    // 24-bit samples are packed little-endian, three bytes per sample
+    void runInt16(const int16_t *in, uint32_t channels, int16_t *out, uint32_t frames);
+    void runInt24(const uint8_t *in, uint32_t channels, uint8_t *out, uint32_t frames);
+    void runInt32(const int32_t *in, uint32_t channels, int32_t *out, uint32_t frames);
+
+#ifdef BARRVERB_COUNTERS
+    const EngineCounters &getCounters() const { return *counters; }
+    void resetCounters();
+#endif
+
+#ifdef BARRVERB_TRACE
+    // Write every RAM address the program touches to a file, for cache
+    // simulation and footprint analysis
+    // Each engine sample is a record of 129 little-endian 16-bit words, the
+    // program number followed by one word per step holding the opcode in the
+    // top two bits and the RAM address in the bottom fourteen
+    // The file starts with the eight bytes BARRTRC1
+    // This does file I/O from run(), so it's strictly for offline use
+    void setTrace(FILE *file);
+#endif
+
+   private:
+    bool silence(float *outL, float *outR, uint32_t frames);
+    void filter(uint32_t frames);
+    void process(uint32_t frames);
+    void runThreaded(uint32_t frames);
+    void prepareProgram();
+
+    const RomImage *image;
+    const Kernels *kern;
+    FamilyKernel family = nullptr;
+    bool use_families = true;
+
+    // the program translated for runThreaded(), a handler number in the
+    // bottom byte of each step and its offset above, with an extra step on
+    // the end to stop
+    uint32_t threaded[129];
+    float sample_rate = 48000;
+    uint16_t prog_offset = 0;
+    uint8_t program = 0;
+
+    EngineState *st = nullptr;
+
+#ifdef BARRVERB_COUNTERS
+    EngineCounters *counters;
+#endif
+
+#ifdef BARRVERB_TRACE
+    static const uint32_t kTraceRecords = 64;
+    void flushTrace();
+    FILE *trace = nullptr;
+    uint32_t trace_used = 0;
+    uint16_t trace_buf[kTraceRecords * 129];
+#endif
+};
+
+#endif  // BARRVERB_ENGINE_HPP
@@ -0,0 +1,201 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "enginethread.hpp"
+
+#include <string.h>
+
+EngineThread::EngineThread(Process process, void *ctx) : process(process), ctx(ctx) {}
+
+EngineThread::~EngineThread() {
+    stop();
+}
+
+uint32_t EngineThread::maxLatency(uint32_t max_block) {
+    // room for the latency's worth of chunks, a host buffer, and one each
+    // being filled and drained, and none at all for a buffer that big
+    uint32_t block_chunks = max_block / kChunk + (max_block % kChunk != 0);
+    if (block_chunks + 2 >= kChunks) return 0;
+    return (kChunks - 2 - block_chunks) * kChunk;
+}
+
+uint32_t EngineThread::start(uint32_t latency, uint32_t max_block) {
+    stop();
+
+    // A chunk isn't sent until its last frame is in, and then it has until
+    // the next host callback to be done, so anything less than a buffer and
+    // a chunk is bound to drop out, and a buffer too big to leave room for
+    // that can't be run on the thread at all
+    uint32_t most = maxLatency(max_block);
+    if (!most || most < max_block + kChunk) return 0;
+
+    uint32_t least = max_block + kChunk;
+    if (latency < least) latency = least;
+    if (latency > most) latency = most;
+    latency = (latency + kChunk - 1) / kChunk * kChunk;
+    this->latency = latency;
+
+    chunks = new Chunk[kChunks];
+    for (uint32_t i = 0; i < kChunks; i++) spare[i] = kChunks - 1 - i;
+    spares = kChunks;
+    filling = draining = -1;
+    filled = 0;
+    in_pos = out_pos = 0;
+    dropouts.store(0, std::memory_order_relaxed);
+
+    quit.store(false, std::memory_order_relaxed);
+    thread = std::thread(&EngineThread::work, this);
+    return latency;
+}
+
+void EngineThread::stop() {
+    if (!chunks) return;
+
+    quit.store(true, std::memory_order_release);
+    wake.post();
+    thread.join();
+
+    // anything left in the rings is thrown away with the chunks
+    uint16_t c;
+    while (to_engine.pop(c)) {
+    }
+    while (from_engine.pop(c)) {
+    }
+    delete[] chunks;
+    chunks = nullptr;
+}
+
+void EngineThread::run(const float *inL, const float *inR, float *outL, float *outR, uint32_t frames) {
+    // in first, since the output may be the same buffers
+    fill(inL, inR, frames);
+    drain(outL, outR, frames);
+}
+
+void EngineThread::fill(const float *inL, const float *inR, uint32_t frames) {
+    while (frames) {
+        if (filling < 0) {
+            if (!spares) {
+                // every chunk is still with the thread, so this input is
+                // lost, drain() will find the gap
+                uint32_t n = kChunk - filled;
+                if (n > frames) n = frames;
+                in_pos += n;
+                filled = (filled + n) % kChunk;
+                frames -= n;
+                dropouts.fetch_add(n, std::memory_order_relaxed);
+                continue;
+            }
+            filling = spare[--spares];
+            chunks[filling].pos = in_pos - filled;
+
+            // picking up partway through a chunk after losing some
+            memset(chunks[filling].l, 0, sizeof(float) * filled);
+            memset(chunks[filling].r, 0, sizeof(float) * filled);
+        }
+
+        Chunk &c = chunks[filling];
+        uint32_t n = kChunk - filled;
+        if (n > frames) n = frames;
+        memcpy(c.l + filled, inL, sizeof(float) * n);
+        memcpy(c.r + filled, inR, sizeof(float) * n);
+        inL += n;
+        inR += n;
+        in_pos += n;
+        filled += n;
+        frames -= n;
+
+        if (filled == kChunk) {
+            // there are only kChunks of them, so this always fits
+            to_engine.push(filling);
+            wake.post();
+            filling = -1;
+            filled = 0;
+        }
+    }
+}
+
+void EngineThread::drain(float *outL, float *outR, uint32_t frames) {
+    while (frames) {
+        // the input frame that this output frame is the processed version of
+        int64_t want = (int64_t)out_pos - latency;
+        uint32_t n = frames;
+        const Chunk *c = nullptr;
+
+        if (want >= 0 && draining < 0) {
+            uint16_t got;
+            if (from_engine.pop(got)) {
+                draining = got;
+            } else {
+                dropouts.fetch_add(frames, std::memory_order_relaxed);
+            }
+        }
+
+        if (want < 0) {
+            // still in the silence at the start
+            if ((uint64_t)-want < n) n = -want;
+        } else if (draining >= 0) {
+            c = &chunks[draining];
+            if (c->pos + kChunk <= (uint64_t)want) {
+                // left over from a dropout
+                spare[spares++] = draining;
+                draining = -1;
+                continue;
+            }
+            if (c->pos > (uint64_t)want) {
+                // a gap where input was lost
+                if (c->pos - want < n) n = c->pos - want;
+                c = nullptr;
+            } else {
+                uint32_t at = want - c->pos;
+                if (kChunk - at < n) n = kChunk - at;
+                memcpy(outL, c->l + at, sizeof(float) * n);
+                memcpy(outR, c->r + at, sizeof(float) * n);
+                if (at + n == kChunk) {
+                    spare[spares++] = draining;
+                    draining = -1;
+                }
+            }
+        }
+
+        if (!c) {
+            memset(outL, 0, sizeof(float) * n);
+            memset(outR, 0, sizeof(float) * n);
+        }
+        outL += n;
+        outR += n;
+        out_pos += n;
+        frames -= n;
+    }
+}
+
+void EngineThread::work() {
+    raisePriority();
+
+    for (;;) {
+        wake.wait();
+        if (quit.load(std::memory_order_acquire)) return;
+
+        // one post for every chunk, but take whatever is there
+        uint16_t i;
+        while (to_engine.pop(i)) {
+            Chunk &c = chunks[i];
+            process(ctx, c.l, c.r, c.l, c.r, kChunk);
+            from_engine.push(i);
+        }
+    }
+}
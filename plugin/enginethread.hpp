@@ -0,0 +1,102 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_ENGINETHREAD_HPP
+#define BARRVERB_ENGINETHREAD_HPP
+
+#include <stdint.h>
+
+#include <atomic>
+#include <thread>
+
+#include "ringbuffer.hpp"
+#include "rtpool.hpp"
+
+// Runs a stereo process on a realtime thread of its own, a small chunk at a
+// time, a fixed number of frames behind the host
+// The host's callback only copies audio in and out, and the work of a big
+// host buffer is spread out over the time until the next one rather than
+// all done at once
+// Chunks go back and forth through SPSC rings, and each one is stamped with
+// where it starts, so if the thread falls behind the output drops out for a
+// moment rather than slipping out of time
+class EngineThread {
+   public:
+    typedef void (*Process)(void *ctx, const float *inL, const float *inR, float *outL, float *outR,
+                            uint32_t frames);
+
+    static const uint32_t kChunk = 64;
+    static const uint32_t kChunks = 512;
+
+    EngineThread(Process process, void *ctx);
+    ~EngineThread();
+
+    // latency is rounded up to whole chunks and is at least a host buffer
+    // and a chunk, returns what it came to, or 0 without starting when a
+    // host buffer is too big for the chunks, for the caller to run the
+    // process itself instead
+    // Not realtime safe, call these from activate() and deactivate()
+    uint32_t start(uint32_t latency, uint32_t max_block);
+    void stop();
+    bool isRunning() const { return chunks != nullptr; }
+
+    // the most latency start() will give for a host buffer size, 0 for one
+    // too big to run on the thread
+    static uint32_t maxLatency(uint32_t max_block);
+
+    // host side, never blocks or allocates
+    void run(const float *inL, const float *inR, float *outL, float *outR, uint32_t frames);
+
+    // frames dropped because the thread fell behind, going in or coming out
+    uint64_t getDropouts() const { return dropouts.load(std::memory_order_relaxed); }
+
+   private:
+    EngineThread(const EngineThread &) = delete;
+    EngineThread &operator=(const EngineThread &) = delete;
+
+    struct Chunk {
+        uint64_t pos;  // of its first frame in the input
+        float l[kChunk], r[kChunk];
+    };
+
+    void work();
+    void fill(const float *inL, const float *inR, uint32_t frames);
+    void drain(float *outL, float *outR, uint32_t frames);
+
+    Process process;
+    void *ctx;
+
+    Chunk *chunks = nullptr;
+    std::thread thread;
+    Semaphore wake;
+    std::atomic<bool> quit{false};
+
+    RingBuffer<uint16_t, kChunks> to_engine, from_engine;
+
+    // host side only
+    uint16_t spare[kChunks];
+    uint32_t spares = 0;
+    int32_t filling = -1, draining = -1;
+    uint32_t filled = 0;
+    uint64_t in_pos = 0, out_pos = 0;
+    uint32_t latency = 0;
+
+    std::atomic<uint64_t> dropouts{0};
+};
+
+#endif  // BARRVERB_ENGINETHREAD_HPP
@@ -0,0 +1,151 @@
+// generated by tools/romgen from midiverb.bin, do not edit
+// the engine's family kernels, see romgen.cpp and engine.cpp
+
+#ifndef BARRVERB_FAMILIES_H
+#define BARRVERB_FAMILIES_H
+
+// 33 varying steps
+//    1 .2 Sec Small Bright
+//    3 .2 Sec Medium Bright
+//    4 .3 Sec Small Bright
+//    6 .4 Sec Medium Bright
+//    8 .6 Sec Small Bright
+FAMILY_KERNEL(family0,
+    FAMILY_STEP(  0, 0) FAMILY_STEP(  1, 1) FAMILY_STEP(  2, 0) FAMILY_STEP(  3, 0) FAMILY_STEP(  4, 0) FAMILY_STEP(  5, 2) FAMILY_STEP(  6, 1) FAMILY_STEP(  7, 2)
+    FAMILY_STEP(  8, 1) FAMILY_STEP(  9, 0) FAMILY_STEP( 10, 0) FAMILY_STEP( 11, 0) FAMILY_STEP( 12, 2) FAMILY_STEP( 13, 1) FAMILY_STEP( 14, 2) FAMILY_STEP( 15, 1)
+    FAMILY_STEP( 16, 3) FAMILY_STEP( 17, 3) FAMILY_STEP( 18, 0) FAMILY_STEP( 19, 0) FAMILY_STEP( 20, 3) FAMILY_STEP( 21, 1) FAMILY_STEP( 22, 0) FAMILY_STEP( 23, 3)
+    FAMILY_STEP( 24, 3) FAMILY_STEP( 25, 0) FAMILY_STEP( 26, 0) FAMILY_STEP( 27, 0) FAMILY_STEP( 28, 0) FAMILY_STEP( 29, 3) FAMILY_STEP( 30, 1) FAMILY_STEP( 31, 0)
+    FAMILY_STEP( 32, 3) FAMILY_STEP( 33, 3) FAMILY_STEP( 34, 0) FAMILY_STEP( 35, 0) FAMILY_STEP( 36, 0) FAMILY_STEP( 37, 0) FAMILY_STEP( 38, 3) FAMILY_STEP( 39, 1)
+    FAMILY_STEP( 40, 3) FAMILY_STEP( 41, 3) FAMILY_STEP( 42, 0) FAMILY_STEP( 43, 0) FAMILY_STEP( 44, 0) FAMILY_STEP( 45, 0) FAMILY_STEP( 46, 3) FAMILY_STEP( 47, 0)
+    FAMILY_STEP( 48, 0) FAMILY_STEP( 49, 2) FAMILY_STEP( 50, 2) FAMILY_STEP( 51, 2) FAMILY_STEP( 52, 2) FAMILY_STEP( 53, 1) FAMILY_STEP( 54, 0) FAMILY_STEP( 55, 3)
+    FAMILY_STEP( 56, 0) FAMILY_STEP( 57, 0) FAMILY_STEP( 58, 2) FAMILY_STEP( 59, 1) FAMILY_ANY( 60) FAMILY_ANY( 61) FAMILY_ANY( 62) FAMILY_STEP( 63, 0)
+    FAMILY_ANY( 64) FAMILY_ANY( 65) FAMILY_ANY( 66) FAMILY_ANY( 67) FAMILY_ANY( 68) FAMILY_ANY( 69) FAMILY_ANY( 70) FAMILY_ANY( 71)
+    FAMILY_ANY( 72) FAMILY_ANY( 73) FAMILY_ANY( 74) FAMILY_ANY( 75) FAMILY_ANY( 76) FAMILY_STEP( 77, 0) FAMILY_ANY( 78) FAMILY_ANY( 79)
+    FAMILY_ANY( 80) FAMILY_ANY( 81) FAMILY_ANY( 82) FAMILY_ANY( 83) FAMILY_ANY( 84) FAMILY_ANY( 85) FAMILY_ANY( 86) FAMILY_ANY( 87)
+    FAMILY_ANY( 88) FAMILY_ANY( 89) FAMILY_ANY( 90) FAMILY_STEP( 91, 0) FAMILY_ANY( 92) FAMILY_ANY( 93) FAMILY_ANY( 94) FAMILY_STEP( 95, 0)
+    FAMILY_STEP( 96, 0) FAMILY_STEP( 97, 0) FAMILY_STEP( 98, 0) FAMILY_ANY( 99) FAMILY_STEP(100, 0) FAMILY_STEP(101, 0) FAMILY_STEP(102, 0) FAMILY_STEP(103, 0)
+    FAMILY_STEP(104, 0) FAMILY_STEP(105, 0) FAMILY_STEP(106, 0) FAMILY_STEP(107, 0) FAMILY_STEP(108, 0) FAMILY_STEP(109, 0) FAMILY_STEP(110, 0) FAMILY_STEP(111, 0)
+    FAMILY_STEP(112, 0) FAMILY_STEP(113, 0) FAMILY_STEP(114, 0) FAMILY_STEP(115, 0) FAMILY_STEP(116, 0) FAMILY_STEP(117, 0) FAMILY_STEP(118, 0) FAMILY_STEP(119, 0)
+    FAMILY_STEP(120, 0) FAMILY_STEP(121, 0) FAMILY_STEP(122, 0) FAMILY_STEP(123, 0) FAMILY_STEP(124, 0) FAMILY_STEP(125, 0) FAMILY_STEP(126, 0) FAMILY_STEP(127, 0)
+)
+
+// 45 varying steps
+//   19 1.4 Sec Large Warm
+//   20 1.4 Sec Large Dark
+//   22 1.6 Sec Small Dark
+//   25 1.8 Sec Large Dark
+//   27 1.8 Sec Medium Warm
+//   29 2.0 Sec Medium Warm
+//   30 2.0 Sec Large Warm
+//   31 2.5 Sec Medium Warm
+//   33 2.5 Sec Medium Bright
+//   37 3.0 Sec Large Warm
+//   38 3.0 Sec Medium Dark
+//   40 3.5 Sec Medium Warm
+//   41 4.0 Sec Large Dark
+//   43 5 Sec Large Warm
+//   45 8 Sec Large Warm
+//   47 10 Sec Large Warm
+//   48 16 Sec Large Dark
+//   50 20 Sec Ex Large Dark
+FAMILY_KERNEL(family1,
+    FAMILY_STEP(  0, 0) FAMILY_STEP(  1, 1) FAMILY_STEP(  2, 0) FAMILY_STEP(  3, 0) FAMILY_STEP(  4, 3) FAMILY_STEP(  5, 3) FAMILY_STEP(  6, 1) FAMILY_STEP(  7, 0)
+    FAMILY_STEP(  8, 0) FAMILY_STEP(  9, 3) FAMILY_STEP( 10, 3) FAMILY_STEP( 11, 1) FAMILY_STEP( 12, 0) FAMILY_STEP( 13, 2) FAMILY_STEP( 14, 1) FAMILY_STEP( 15, 2)
+    FAMILY_STEP( 16, 2) FAMILY_STEP( 17, 2) FAMILY_STEP( 18, 2) FAMILY_STEP( 19, 0) FAMILY_STEP( 20, 3) FAMILY_STEP( 21, 0) FAMILY_STEP( 22, 0) FAMILY_STEP( 23, 0)
+    FAMILY_STEP( 24, 3) FAMILY_STEP( 25, 0) FAMILY_STEP( 26, 0) FAMILY_STEP( 27, 0) FAMILY_STEP( 28, 3) FAMILY_STEP( 29, 0) FAMILY_STEP( 30, 0) FAMILY_STEP( 31, 0)
+    FAMILY_STEP( 32, 3) FAMILY_STEP( 33, 0) FAMILY_STEP( 34, 0) FAMILY_ANY( 35) FAMILY_ANY( 36) FAMILY_STEP( 37, 0) FAMILY_STEP( 38, 0) FAMILY_ANY( 39)
+    FAMILY_ANY( 40) FAMILY_STEP( 41, 0) FAMILY_ANY( 42) FAMILY_ANY( 43) FAMILY_ANY( 44) FAMILY_ANY( 45) FAMILY_ANY( 46) FAMILY_ANY( 47)
+    FAMILY_ANY( 48) FAMILY_ANY( 49) FAMILY_ANY( 50) FAMILY_ANY( 51) FAMILY_ANY( 52) FAMILY_ANY( 53) FAMILY_ANY( 54) FAMILY_ANY( 55)
+    FAMILY_ANY( 56) FAMILY_ANY( 57) FAMILY_ANY( 58) FAMILY_ANY( 59) FAMILY_ANY( 60) FAMILY_ANY( 61) FAMILY_ANY( 62) FAMILY_ANY( 63)
+    FAMILY_ANY( 64) FAMILY_ANY( 65) FAMILY_ANY( 66) FAMILY_ANY( 67) FAMILY_ANY( 68) FAMILY_ANY( 69) FAMILY_ANY( 70) FAMILY_ANY( 71)
+    FAMILY_ANY( 72) FAMILY_ANY( 73) FAMILY_ANY( 74) FAMILY_ANY( 75) FAMILY_ANY( 76) FAMILY_ANY( 77) FAMILY_ANY( 78) FAMILY_ANY( 79)
+    FAMILY_ANY( 80) FAMILY_ANY( 81) FAMILY_STEP( 82, 0) FAMILY_STEP( 83, 0) FAMILY_ANY( 84) FAMILY_STEP( 85, 0) FAMILY_STEP( 86, 0) FAMILY_STEP( 87, 0)
+    FAMILY_STEP( 88, 0) FAMILY_STEP( 89, 0) FAMILY_STEP( 90, 0) FAMILY_STEP( 91, 0) FAMILY_STEP( 92, 0) FAMILY_STEP( 93, 0) FAMILY_STEP( 94, 0) FAMILY_STEP( 95, 0)
+    FAMILY_STEP( 96, 0) FAMILY_STEP( 97, 0) FAMILY_STEP( 98, 0) FAMILY_STEP( 99, 0) FAMILY_STEP(100, 0) FAMILY_STEP(101, 0) FAMILY_STEP(102, 0) FAMILY_STEP(103, 0)
+    FAMILY_STEP(104, 0) FAMILY_STEP(105, 0) FAMILY_STEP(106, 0) FAMILY_STEP(107, 0) FAMILY_STEP(108, 0) FAMILY_STEP(109, 0) FAMILY_STEP(110, 0) FAMILY_STEP(111, 0)
+    FAMILY_STEP(112, 0) FAMILY_STEP(113, 0) FAMILY_STEP(114, 0) FAMILY_STEP(115, 0) FAMILY_STEP(116, 0) FAMILY_STEP(117, 0) FAMILY_STEP(118, 0) FAMILY_STEP(119, 0)
+    FAMILY_STEP(120, 0) FAMILY_STEP(121, 0) FAMILY_STEP(122, 0) FAMILY_STEP(123, 0) FAMILY_STEP(124, 0) FAMILY_STEP(125, 0) FAMILY_STEP(126, 0) FAMILY_STEP(127, 0)
+)
+
+// 45 varying steps
+//   23 1.6 Sec Large Bright
+//   24 1.6 Sec Medium Bright
+//   26 1.8 Sec Large Bright
+//   28 2.0 Sec Large Bright
+//   32 2.5 Sec Large Bright
+//   34 2.8 Sec Small Bright
+//   35 2.8 Sec Medium Bright
+//   36 3.0 Sec Large Bright
+//   39 3.5 Sec Large Bright
+//   42 4.0 Sec Medium Bright
+//   44 8 Sec Large Bright
+//   46 10 Sec Large Bright
+//   49 18 Sec Ex. Large Bright
+FAMILY_KERNEL(family2,
+    FAMILY_STEP(  0, 0) FAMILY_STEP(  1, 1) FAMILY_STEP(  2, 0) FAMILY_STEP(  3, 0) FAMILY_STEP(  4, 3) FAMILY_STEP(  5, 3) FAMILY_STEP(  6, 1) FAMILY_STEP(  7, 0)
+    FAMILY_STEP(  8, 0) FAMILY_STEP(  9, 3) FAMILY_STEP( 10, 3) FAMILY_STEP( 11, 1) FAMILY_STEP( 12, 2) FAMILY_STEP( 13, 2) FAMILY_STEP( 14, 2) FAMILY_STEP( 15, 2)
+    FAMILY_STEP( 16, 0) FAMILY_STEP( 17, 3) FAMILY_STEP( 18, 0) FAMILY_STEP( 19, 0) FAMILY_STEP( 20, 0) FAMILY_STEP( 21, 3) FAMILY_STEP( 22, 0) FAMILY_STEP( 23, 0)
+    FAMILY_STEP( 24, 0) FAMILY_STEP( 25, 3) FAMILY_STEP( 26, 0) FAMILY_STEP( 27, 0) FAMILY_STEP( 28, 0) FAMILY_STEP( 29, 3) FAMILY_STEP( 30, 0) FAMILY_STEP( 31, 0)
+    FAMILY_ANY( 32) FAMILY_ANY( 33) FAMILY_STEP( 34, 0) FAMILY_STEP( 35, 0) FAMILY_ANY( 36) FAMILY_ANY( 37) FAMILY_STEP( 38, 0) FAMILY_ANY( 39)
+    FAMILY_ANY( 40) FAMILY_ANY( 41) FAMILY_ANY( 42) FAMILY_ANY( 43) FAMILY_ANY( 44) FAMILY_ANY( 45) FAMILY_ANY( 46) FAMILY_ANY( 47)
+    FAMILY_ANY( 48) FAMILY_ANY( 49) FAMILY_ANY( 50) FAMILY_ANY( 51) FAMILY_ANY( 52) FAMILY_ANY( 53) FAMILY_ANY( 54) FAMILY_ANY( 55)
+    FAMILY_ANY( 56) FAMILY_ANY( 57) FAMILY_ANY( 58) FAMILY_ANY( 59) FAMILY_ANY( 60) FAMILY_ANY( 61) FAMILY_ANY( 62) FAMILY_ANY( 63)
+    FAMILY_ANY( 64) FAMILY_ANY( 65) FAMILY_ANY( 66) FAMILY_ANY( 67) FAMILY_ANY( 68) FAMILY_ANY( 69) FAMILY_ANY( 70) FAMILY_ANY( 71)
+    FAMILY_ANY( 72) FAMILY_ANY( 73) FAMILY_ANY( 74) FAMILY_ANY( 75) FAMILY_ANY( 76) FAMILY_ANY( 77) FAMILY_ANY( 78) FAMILY_STEP( 79, 0)
+    FAMILY_STEP( 80, 0) FAMILY_ANY( 81) FAMILY_STEP( 82, 0) FAMILY_STEP( 83, 0) FAMILY_STEP( 84, 0) FAMILY_STEP( 85, 0) FAMILY_STEP( 86, 0) FAMILY_STEP( 87, 0)
+    FAMILY_STEP( 88, 0) FAMILY_STEP( 89, 0) FAMILY_STEP( 90, 0) FAMILY_STEP( 91, 0) FAMILY_STEP( 92, 0) FAMILY_STEP( 93, 0) FAMILY_STEP( 94, 0) FAMILY_STEP( 95, 0)
+    FAMILY_STEP( 96, 0) FAMILY_STEP( 97, 0) FAMILY_STEP( 98, 0) FAMILY_STEP( 99, 0) FAMILY_STEP(100, 0) FAMILY_STEP(101, 0) FAMILY_STEP(102, 0) FAMILY_STEP(103, 0)
+    FAMILY_STEP(104, 0) FAMILY_STEP(105, 0) FAMILY_STEP(106, 0) FAMILY_STEP(107, 0) FAMILY_STEP(108, 0) FAMILY_STEP(109, 0) FAMILY_STEP(110, 0) FAMILY_STEP(111, 0)
+    FAMILY_STEP(112, 0) FAMILY_STEP(113, 0) FAMILY_STEP(114, 0) FAMILY_STEP(115, 0) FAMILY_STEP(116, 0) FAMILY_STEP(117, 0) FAMILY_STEP(118, 0) FAMILY_STEP(119, 0)
+    FAMILY_STEP(120, 0) FAMILY_STEP(121, 0) FAMILY_STEP(122, 0) FAMILY_STEP(123, 0) FAMILY_STEP(124, 0) FAMILY_STEP(125, 0) FAMILY_STEP(126, 0) FAMILY_STEP(127, 0)
+)
+
+// 38 varying steps
+//   51 Gated - 100ms
+//   52 Gated - 150ms
+//   53 Gated - 200ms
+//   54 Gated - 250ms
+//   55 Gated - 300ms
+//   56 Gated - 350ms
+//   57 Gated - 400ms
+//   58 Gated - 500ms
+//   59 Gated - 600ms
+//   60 Reverse - 300ms
+//   61 Reverse - 400ms
+//   62 Reverse - 500ms
+//   63 Reverse - 600ms
+FAMILY_KERNEL(family3,
+    FAMILY_STEP(  0, 0) FAMILY_STEP(  1, 1) FAMILY_STEP(  2, 0) FAMILY_STEP(  3, 3) FAMILY_STEP(  4, 0) FAMILY_STEP(  5, 0) FAMILY_STEP(  6, 0) FAMILY_STEP(  7, 3)
+    FAMILY_STEP(  8, 0) FAMILY_STEP(  9, 0) FAMILY_STEP( 10, 0) FAMILY_STEP( 11, 3) FAMILY_STEP( 12, 0) FAMILY_STEP( 13, 0) FAMILY_ANY( 14) FAMILY_ANY( 15)
+    FAMILY_ANY( 16) FAMILY_ANY( 17) FAMILY_STEP( 18, 0) FAMILY_ANY( 19) FAMILY_STEP( 20, 0) FAMILY_ANY( 21) FAMILY_STEP( 22, 0) FAMILY_ANY( 23)
+    FAMILY_STEP( 24, 0) FAMILY_ANY( 25) FAMILY_STEP( 26, 0) FAMILY_ANY( 27) FAMILY_ANY( 28) FAMILY_ANY( 29) FAMILY_STEP( 30, 0) FAMILY_STEP( 31, 0)
+    FAMILY_ANY( 32) FAMILY_ANY( 33) FAMILY_STEP( 34, 0) FAMILY_STEP( 35, 0) FAMILY_STEP( 36, 0) FAMILY_STEP( 37, 0) FAMILY_STEP( 38, 0) FAMILY_STEP( 39, 0)
+    FAMILY_STEP( 40, 0) FAMILY_STEP( 41, 0) FAMILY_ANY( 42) FAMILY_STEP( 43, 0) FAMILY_STEP( 44, 0) FAMILY_STEP( 45, 0) FAMILY_ANY( 46) FAMILY_STEP( 47, 0)
+    FAMILY_ANY( 48) FAMILY_STEP( 49, 0) FAMILY_STEP( 50, 0) FAMILY_STEP( 51, 0) FAMILY_STEP( 52, 0) FAMILY_ANY( 53) FAMILY_ANY( 54) FAMILY_STEP( 55, 0)
+    FAMILY_STEP( 56, 0) FAMILY_STEP( 57, 0) FAMILY_STEP( 58, 0) FAMILY_STEP( 59, 0) FAMILY_ANY( 60) FAMILY_ANY( 61) FAMILY_STEP( 62, 0) FAMILY_STEP( 63, 0)
+    FAMILY_ANY( 64) FAMILY_ANY( 65) FAMILY_STEP( 66, 0) FAMILY_ANY( 67) FAMILY_STEP( 68, 0) FAMILY_STEP( 69, 0) FAMILY_ANY( 70) FAMILY_STEP( 71, 0)
+    FAMILY_STEP( 72, 0) FAMILY_STEP( 73, 0) FAMILY_ANY( 74) FAMILY_ANY( 75) FAMILY_STEP( 76, 0) FAMILY_STEP( 77, 0) FAMILY_ANY( 78) FAMILY_STEP( 79, 0)
+    FAMILY_STEP( 80, 0) FAMILY_ANY( 81) FAMILY_ANY( 82) FAMILY_STEP( 83, 0) FAMILY_STEP( 84, 0) FAMILY_STEP( 85, 0) FAMILY_STEP( 86, 0) FAMILY_ANY( 87)
+    FAMILY_ANY( 88) FAMILY_STEP( 89, 0) FAMILY_STEP( 90, 0) FAMILY_STEP( 91, 0) FAMILY_STEP( 92, 0) FAMILY_STEP( 93, 0) FAMILY_ANY( 94) FAMILY_STEP( 95, 0)
+    FAMILY_STEP( 96, 0) FAMILY_STEP( 97, 0) FAMILY_STEP( 98, 0) FAMILY_ANY( 99) FAMILY_STEP(100, 0) FAMILY_STEP(101, 0) FAMILY_STEP(102, 0) FAMILY_STEP(103, 0)
+    FAMILY_STEP(104, 0) FAMILY_STEP(105, 0) FAMILY_STEP(106, 0) FAMILY_STEP(107, 0) FAMILY_STEP(108, 0) FAMILY_ANY(109) FAMILY_ANY(110) FAMILY_STEP(111, 0)
+    FAMILY_STEP(112, 0) FAMILY_STEP(113, 0) FAMILY_STEP(114, 0) FAMILY_STEP(115, 0) FAMILY_STEP(116, 0) FAMILY_STEP(117, 0) FAMILY_ANY(118) FAMILY_STEP(119, 0)
+    FAMILY_STEP(120, 0) FAMILY_STEP(121, 0) FAMILY_ANY(122) FAMILY_STEP(123, 0) FAMILY_STEP(124, 0) FAMILY_STEP(125, 0) FAMILY_STEP(126, 0) FAMILY_ANY(127)
+)
+
+static const FamilyInfo families[] = {
+    {family0,
+     "010002121000212133003103300003103300003133000030022221030021xxx0"
+     "xxxxxxxxxxxxx0xxxxxxxxxxxxx0xxx0000x0000000000000000000000000000"},
+    {family1,
+     "01003310033102122220300030003000300xx00xx0xxxxxxxxxxxxxxxxxxxxxx"
+     "xxxxxxxxxxxxxxxxxx00x0000000000000000000000000000000000000000000"},
+    {family2,
+     "01003310033122220300030003000300xx00xx0xxxxxxxxxxxxxxxxxxxxxxxxx"
+     "xxxxxxxxxxxxxxx00x0000000000000000000000000000000000000000000000"},
+    {family3,
+     "01030003000300xxxx0x0x0x0x0xxx00xx00000000x000x0x0000xx00000xx00"
+     "xx0x00x000xx00x00xx0000xx00000x0000x000000000xx0000000x000x0000x"},
+};
+
+#endif  // BARRVERB_FAMILIES_H
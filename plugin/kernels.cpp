@@ -0,0 +1,281 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "kernels.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define KERNELS_X86 1
+#endif
+
+// Contracting a multiply and add into an FMA would round differently on the
+// variants that have one, so don't
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+#ifdef __GNUC__
+#define KERNEL_BODY static inline __attribute__((always_inline))
+#else
+#define KERNEL_BODY static inline
+#endif
+
+// The loop bodies are written once, as plain C++ that the compiler can
+// vectorise, and inlined into a wrapper for each instruction set below
+
+// The sums for each output are always made in the same order, whether the
+// block is run in one go or a sample at a time, so both give the same answer
+KERNEL_BODY void cascadeBody(Cascade &c, float *io, uint32_t frames) {
+    const uint32_t N = Cascade::kSteps;
+
+    while (frames) {
+        if (c.fill == 0 && frames >= N) {
+            // a whole block, across all eight outputs at once
+            float y[N], s[4];
+            for (uint32_t k = 0; k < N; k++) y[k] = c.ys[0][k] * c.s[0];
+            for (uint32_t i = 1; i < 4; i++)
+                for (uint32_t k = 0; k < N; k++) y[k] += c.ys[i][k] * c.s[i];
+            for (uint32_t j = 0; j < N; j++)
+                for (uint32_t k = 0; k < N; k++) y[k] += c.yu[j][k] * io[j];
+
+            for (uint32_t r = 0; r < 4; r++) s[r] = c.ss[0][r] * c.s[0];
+            for (uint32_t i = 1; i < 4; i++)
+                for (uint32_t r = 0; r < 4; r++) s[r] += c.ss[i][r] * c.s[i];
+            for (uint32_t j = 0; j < N; j++)
+                for (uint32_t r = 0; r < 4; r++) s[r] += c.su[j][r] * io[j];
+
+            for (uint32_t r = 0; r < 4; r++) c.s[r] = s[r];
+            for (uint32_t k = 0; k < N; k++) io[k] = y[k];
+            io += N;
+            frames -= N;
+            continue;
+        }
+
+        // otherwise a sample at a time until the block is complete
+        uint32_t k = c.fill++;
+        c.u[k] = *io;
+        float y = c.ys[0][k] * c.s[0];
+        for (uint32_t i = 1; i < 4; i++) y += c.ys[i][k] * c.s[i];
+        for (uint32_t j = 0; j < N; j++) y += c.yu[j][k] * (j <= k ? c.u[j] : 0.0f);
+        *io++ = y;
+        frames--;
+
+        if (c.fill == N) {
+            float s[4];
+            for (uint32_t r = 0; r < 4; r++) s[r] = c.ss[0][r] * c.s[0];
+            for (uint32_t i = 1; i < 4; i++)
+                for (uint32_t r = 0; r < 4; r++) s[r] += c.ss[i][r] * c.s[i];
+            for (uint32_t j = 0; j < N; j++)
+                for (uint32_t r = 0; r < 4; r++) s[r] += c.su[j][r] * c.u[j];
+            for (uint32_t r = 0; r < 4; r++) c.s[r] = s[r];
+            c.fill = 0;
+        }
+    }
+}
+
+KERNEL_BODY void mixFloatBody(const float *inL, const float *inR, float *out, uint32_t frames) {
+    for (uint32_t i = 0; i < frames; i++) {
+        // smash to mono
+        out[i] = (inL[i] + inR[i]) / 2;
+    }
+}
+
+KERNEL_BODY void dacToFloatBody(const int16_t *dacL, const int16_t *dacR, float *outL, float *outR, uint32_t frames) {
+    for (uint32_t i = 0; i < frames; i++) {
+        outL[i] = (float)dacL[i] / 2048;
+        outR[i] = (float)dacR[i] / 2048;
+    }
+}
+
+KERNEL_BODY void int16InBody(const int16_t *in, uint32_t channels, float *out, uint32_t frames) {
+    const float scale = 1.0f / (32768.0f * channels);
+
+    if (channels == 2) {
+        for (uint32_t i = 0; i < frames; i++) {
+            out[i] = (float)(in[2 * i] + in[2 * i + 1]) * scale;
+        }
+    } else {
+        for (uint32_t i = 0; i < frames; i++) {
+            int32_t sum = 0;
+            for (uint32_t c = 0; c < channels; c++) sum += in[i * channels + c];
+            out[i] = (float)sum * scale;
+        }
+    }
+}
+
+static inline int32_t read24(const uint8_t *p) {
+    // sign-extend from the top byte
+    return (int32_t)((uint32_t)p[0] << 8 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 24) >> 8;
+}
+
+static inline void write24(uint8_t *p, int32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+}
+
+KERNEL_BODY void int24InBody(const uint8_t *in, uint32_t channels, float *out, uint32_t frames) {
+    const float scale = 1.0f / (8388608.0f * channels);
+
+    if (channels == 2) {
+        for (uint32_t i = 0; i < frames; i++) {
+            out[i] = (float)(read24(in + 6 * i) + read24(in + 6 * i + 3)) * scale;
+        }
+    } else {
+        // in 64 bits, so that it can't overflow however many channels there are
+        for (uint32_t i = 0; i < frames; i++) {
+            int64_t sum = 0;
+            for (uint32_t c = 0; c < channels; c++) sum += read24(in + 3 * (i * channels + c));
+            out[i] = (float)sum * scale;
+        }
+    }
+}
+
+KERNEL_BODY void int32InBody(const int32_t *in, uint32_t channels, float *out, uint32_t frames) {
+    // sum in float, two full-scale int32s would overflow
+    const float scale = 1.0f / (2147483648.0f * channels);
+
+    if (channels == 2) {
+        for (uint32_t i = 0; i < frames; i++) {
+            out[i] = ((float)in[2 * i] + (float)in[2 * i + 1]) * scale;
+        }
+    } else {
+        for (uint32_t i = 0; i < frames; i++) {
+            float sum = 0;
+            for (uint32_t c = 0; c < channels; c++) sum += (float)in[i * channels + c];
+            out[i] = sum * scale;
+        }
+    }
+}
+
+// the output side never touches floating point, the 12-bit DAC word is just shifted up
+
+KERNEL_BODY void int16OutBody(const int16_t *dacL, const int16_t *dacR, int16_t *out, uint32_t frames) {
+    for (uint32_t i = 0; i < frames; i++) {
+        out[2 * i] = dacL[i] * 16;
+        out[2 * i + 1] = dacR[i] * 16;
+    }
+}
+
+KERNEL_BODY void int24OutBody(const int16_t *dacL, const int16_t *dacR, uint8_t *out, uint32_t frames) {
+    for (uint32_t i = 0; i < frames; i++) {
+        write24(out + 6 * i, dacL[i] * 4096);
+        write24(out + 6 * i + 3, dacR[i] * 4096);
+    }
+}
+
+KERNEL_BODY void int32OutBody(const int16_t *dacL, const int16_t *dacR, int32_t *out, uint32_t frames) {
+    for (uint32_t i = 0; i < frames; i++) {
+        out[2 * i] = dacL[i] * 1048576;
+        out[2 * i + 1] = dacR[i] * 1048576;
+    }
+}
+
+// one set of wrappers and a table for each variant
+#define DEFINE_KERNELS(isa, attr)                                                                   \
+    attr static void isa##Cascade(Cascade &c, float *io, uint32_t n) {                              \
+        cascadeBody(c, io, n);                                                                      \
+    }                                                                                               \
+    attr static void isa##MixFloat(const float *l, const float *r, float *o, uint32_t n) {          \
+        mixFloatBody(l, r, o, n);                                                                   \
+    }                                                                                               \
+    attr static void isa##DacToFloat(const int16_t *l, const int16_t *r, float *ol, float *orr,    \
+                                     uint32_t n) {                                                  \
+        dacToFloatBody(l, r, ol, orr, n);                                                           \
+    }                                                                                               \
+    attr static void isa##Int16In(const int16_t *in, uint32_t c, float *o, uint32_t n) {           \
+        int16InBody(in, c, o, n);                                                                   \
+    }                                                                                               \
+    attr static void isa##Int24In(const uint8_t *in, uint32_t c, float *o, uint32_t n) {           \
+        int24InBody(in, c, o, n);                                                                   \
+    }                                                                                               \
+    attr static void isa##Int32In(const int32_t *in, uint32_t c, float *o, uint32_t n) {           \
+        int32InBody(in, c, o, n);                                                                   \
+    }                                                                                               \
+    attr static void isa##Int16Out(const int16_t *l, const int16_t *r, int16_t *o, uint32_t n) {   \
+        int16OutBody(l, r, o, n);                                                                   \
+    }                                                                                               \
+    attr static void isa##Int24Out(const int16_t *l, const int16_t *r, uint8_t *o, uint32_t n) {   \
+        int24OutBody(l, r, o, n);                                                                   \
+    }                                                                                               \
+    attr static void isa##Int32Out(const int16_t *l, const int16_t *r, int32_t *o, uint32_t n) {   \
+        int32OutBody(l, r, o, n);                                                                   \
+    }                                                                                               \
+    static const Kernels isa##Kernels = {#isa,          isa##Cascade,  isa##MixFloat, isa##DacToFloat, \
+                                         isa##Int16In,  isa##Int24In,  isa##Int32In,                \
+                                         isa##Int16Out, isa##Int24Out, isa##Int32Out};
+
+// the scalar fallback is always there, and really is scalar where the compiler lets us say so
+#if defined(__GNUC__) && !defined(__clang__)
+DEFINE_KERNELS(scalar, __attribute__((optimize("no-tree-vectorize"))))
+#else
+DEFINE_KERNELS(scalar, )
+#endif
+
+#ifdef KERNELS_X86
+// no FMA in any of these, so that every variant rounds the same way
+DEFINE_KERNELS(sse2, __attribute__((target("sse2"))))
+DEFINE_KERNELS(avx2, __attribute__((target("avx2"))))
+DEFINE_KERNELS(avx512, __attribute__((target("avx512f,avx512bw"))))
+#endif
+
+static bool supported(const Kernels *k) {
+#ifdef KERNELS_X86
+    __builtin_cpu_init();
+    if (k == &sse2Kernels) return __builtin_cpu_supports("sse2");
+    if (k == &avx2Kernels) return __builtin_cpu_supports("avx2");
+    if (k == &avx512Kernels) return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+#endif
+    return k == &scalarKernels;
+}
+
+const Kernels *kernelsFind(const char *name) {
+    static const Kernels *const all[] = {
+        &scalarKernels,
+#ifdef KERNELS_X86
+        &sse2Kernels,
+        &avx2Kernels,
+        &avx512Kernels,
+#endif
+    };
+
+    for (size_t i = 0; i < sizeof(all) / sizeof(all[0]); i++) {
+        if (!strcmp(all[i]->name, name)) return supported(all[i]) ? all[i] : nullptr;
+    }
+    return nullptr;
+}
+
+const Kernels *kernelsSelect() {
+    const char *force = getenv("BARRVERB_KERNELS");
+    if (force) {
+        const Kernels *k = kernelsFind(force);
+        if (k) return k;
+    }
+
+    // best first
+    static const char *const order[] = {"avx512", "avx2", "sse2"};
+    for (size_t i = 0; i < sizeof(order) / sizeof(order[0]); i++) {
+        const Kernels *k = kernelsFind(order[i]);
+        if (k) return k;
+    }
+    return &scalarKernels;
+}
@@ -0,0 +1,61 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_KERNELS_HPP
+#define BARRVERB_KERNELS_HPP
+
+#include <stdint.h>
+
+#include "cascade.hpp"
+
+// The vectorisable inner loops of the engine, built several times over for
+// different instruction sets and picked once, when an engine is created
+// The DSP program itself is strictly serial and isn't in here
+// All the variants give bit-identical results, floating point included
+struct Kernels {
+    const char *name;
+
+    // the input filters, in place
+    void (*cascade)(Cascade &c, float *io, uint32_t frames);
+
+    // planar float in, summed to mono
+    void (*mixFloat)(const float *inL, const float *inR, float *out, uint32_t frames);
+    // 12-bit DAC words out to planar float
+    void (*dacToFloat)(const int16_t *dacL, const int16_t *dacR, float *outL, float *outR, uint32_t frames);
+
+    // interleaved PCM with any number of channels in, summed to mono
+    // channels has to be at least one, see BarrEngine::runInt16()
+    void (*int16In)(const int16_t *in, uint32_t channels, float *out, uint32_t frames);
+    void (*int24In)(const uint8_t *in, uint32_t channels, float *out, uint32_t frames);
+    void (*int32In)(const int32_t *in, uint32_t channels, float *out, uint32_t frames);
+
+    // DAC words out to interleaved stereo PCM
+    void (*int16Out)(const int16_t *dacL, const int16_t *dacR, int16_t *out, uint32_t frames);
+    void (*int24Out)(const int16_t *dacL, const int16_t *dacR, uint8_t *out, uint32_t frames);
+    void (*int32Out)(const int16_t *dacL, const int16_t *dacR, int32_t *out, uint32_t frames);
+};
+
+// The best variant this CPU supports
+// Setting BARRVERB_KERNELS to scalar, sse2, avx2 or avx512 in the
+// environment forces a particular one, if the CPU can run it
+const Kernels *kernelsSelect();
+
+// a particular variant by name, or nullptr if it isn't built or can't run here
+const Kernels *kernelsFind(const char *name);
+
+#endif  // BARRVERB_KERNELS_HPP
@@ -0,0 +1,108 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_LOADMETER_HPP
+#define BARRVERB_LOADMETER_HPP
+
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+
+#include "ringbuffer.hpp"
+
+// one entry in the stats feed
+struct BlockTiming {
+    uint64_t start_ns;  // steady clock, arbitrary epoch
+    uint32_t elapsed_ns;
+    uint32_t frames;
+};
+
+// Times each block on the audio thread and works out how much of the
+// available time it took
+// Whichever thread runs the engine is the only writer, so everything is
+// relaxed loads and stores apart from the stats feed, which another thread
+// drains with pop()
+// Blocks only go into the feed while a reader is attached, so what it reads
+// is always from after it attached, never left over from start-up
+class LoadMeter {
+   public:
+    // histogram bins are 10% of the block's time budget each, the last one
+    // catches everything from 150% upwards
+    static const uint32_t kBins = 16;
+
+    void setSampleRate(double rate) { ns_per_frame = 1e9 / rate; }
+
+    // audio thread
+    void begin() { start = now(); }
+    void end(uint32_t frames) {
+        uint64_t finish = now();
+        if (!frames) return;
+
+        uint32_t elapsed = finish - start;
+        float budget = frames * ns_per_frame;
+        float l = elapsed / budget;
+
+        load.store(l, std::memory_order_relaxed);
+        if (l > peak.load(std::memory_order_relaxed)) peak.store(l, std::memory_order_relaxed);
+
+        uint32_t bin = l * 10;
+        if (bin >= kBins) bin = kBins - 1;
+        histogram[bin].store(histogram[bin].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+        // a reader that falls behind loses the newest blocks until it catches up
+        if (!reading.load(std::memory_order_relaxed)) return;
+        BlockTiming t = {start, elapsed, frames};
+        feed.push(t);
+    }
+
+    // any thread, as fractions of the time available for the block
+    float getLoad() const { return load.load(std::memory_order_relaxed); }
+    float getPeak() const { return peak.load(std::memory_order_relaxed); }
+    uint32_t getBin(uint32_t bin) const { return histogram[bin].load(std::memory_order_relaxed); }
+    void resetPeak() { peak.store(0, std::memory_order_relaxed); }
+
+    // a single non-realtime reader, between attachReader() and detachReader()
+    void attachReader() {
+        // throw away whatever was left from the last reader
+        BlockTiming t;
+        while (feed.pop(t)) continue;
+        reading.store(true, std::memory_order_relaxed);
+    }
+    void detachReader() { reading.store(false, std::memory_order_relaxed); }
+    bool pop(BlockTiming &t) { return feed.pop(t); }
+
+   private:
+    static uint64_t now() {
+        // a vDSO clock_gettime() on Linux, so no syscall
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    double ns_per_frame = 1e9 / 48000;
+    uint64_t start = 0;
+
+    std::atomic<float> load{0};
+    std::atomic<float> peak{0};
+    std::atomic<uint32_t> histogram[kBins] = {};
+    std::atomic<bool> reading{false};
+    RingBuffer<BlockTiming, 256> feed;
+};
+
+#endif  // BARRVERB_LOADMETER_HPP
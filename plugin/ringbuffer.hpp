@@ -0,0 +1,103 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_RINGBUFFER_HPP
+#define BARRVERB_RINGBUFFER_HPP
+
+#include <stdint.h>
+
+#include <atomic>
+
+// Fixed-size single producer, single consumer queue
+// Neither side ever blocks or allocates, so either end can be the audio thread
+// N must be a power of two
+template <class T, uint32_t N>
+class RingBuffer {
+   public:
+    bool push(const T &item) {
+        uint32_t w = head.load(std::memory_order_relaxed);
+        if (w - tail.load(std::memory_order_acquire) == N) return false;
+        items[w & (N - 1)] = item;
+        head.store(w + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T &item) {
+        uint32_t r = tail.load(std::memory_order_relaxed);
+        if (head.load(std::memory_order_acquire) == r) return false;
+        item = items[r & (N - 1)];
+        tail.store(r + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool full() const {
+        return head.load(std::memory_order_relaxed) - tail.load(std::memory_order_acquire) == N;
+    }
+
+   private:
+    static_assert((N & (N - 1)) == 0, "ring size must be a power of two");
+
+    // keep the two ends on separate cache lines
+    // padded rather than aligned, so that the owner needn't be allocated aligned
+    std::atomic<uint32_t> head{0};
+    char pad_head[64 - sizeof(std::atomic<uint32_t>)];
+    std::atomic<uint32_t> tail{0};
+    char pad_tail[64 - sizeof(std::atomic<uint32_t>)];
+    T items[N];
+};
+
+// Hands heap objects from a non-realtime thread to the audio thread
+// The publisher owns everything that isn't current, and frees whatever the
+// audio thread has finished with on its next publish
+template <class T>
+class Handoff {
+   public:
+    typedef void (*Dispose)(T *);
+
+    explicit Handoff(Dispose dispose) : dispose(dispose) {}
+    ~Handoff() { collect(); }
+
+    // publisher side
+    void publish(T *obj) {
+        collect();
+        T *old = pending.exchange(obj, std::memory_order_acq_rel);
+        if (old) dispose(old);  // never seen by the audio thread
+    }
+
+    void collect() {
+        T *old;
+        while (retired.pop(old)) dispose(old);
+        old = pending.exchange(nullptr, std::memory_order_acq_rel);
+        if (old) dispose(old);
+    }
+
+    // audio thread side
+    T *take() {
+        if (retired.full()) return nullptr;
+        return pending.exchange(nullptr, std::memory_order_acq_rel);
+    }
+
+    void retire(T *obj) { retired.push(obj); }
+
+   private:
+    Dispose dispose;
+    std::atomic<T *> pending{nullptr};
+    RingBuffer<T *, 4> retired;
+};
+
+#endif  // BARRVERB_RINGBUFFER_HPP
@@ -0,0 +1,59 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "romimage.hpp"
+
+#include <string.h>
+
+// Kept apart from romimage.cpp, which needs rom.h, so that the ROM
+// generator in tools/ can use the same decoder to build rom.h itself
+
+void romPermute(const uint16_t *raw, uint16_t *out) {
+    // the DSP latches the offset one step late and the opcode two steps late
+    // the program counter wraps within the 128 words of each program
+    for (uint32_t prog = 0; prog < kRomWords; prog += 128) {
+        for (uint32_t step = 0; step < 128; step++) {
+            out[prog + step] = (raw[prog + ((step - 2) & 0x7f)] & 0xc000) |
+                               (raw[prog + ((step - 1) & 0x7f)] & 0x3fff);
+        }
+    }
+}
+
+bool romDecode(const uint8_t *data, size_t size, RomFormat format, uint16_t *out) {
+    bool magic = size == kRomMagicSize + kRomBytes && !memcmp(data, ROM_IMAGE_MAGIC, kRomMagicSize);
+
+    if (format == kRomAuto) format = magic ? kRomPermuted : kRomRaw;
+    if (format == kRomPermuted && magic) {
+        data += kRomMagicSize;
+        size -= kRomMagicSize;
+    }
+    if (size != kRomBytes) return false;
+
+    // the EPROM is eight bits wide, low byte first
+    uint16_t words[kRomWords];
+    for (uint32_t i = 0; i < kRomWords; i++) {
+        words[i] = data[2 * i] | data[2 * i + 1] << 8;
+    }
+
+    if (format == kRomRaw) {
+        romPermute(words, out);
+    } else {
+        memcpy(out, words, kRomBytes);
+    }
+    return true;
+}
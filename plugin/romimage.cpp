@@ -0,0 +1,162 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "romimage.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <mutex>
+#include <new>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <malloc.h>
+#endif
+
+#include "rom.h"
+
+static_assert(sizeof(rom) == kRomBytes, "rom.h is the wrong size");
+
+// the cache of every image in use by any instance
+static std::mutex cache_lock;
+static std::vector<RomImage *> &cache() {
+    static std::vector<RomImage *> images;
+    return images;
+}
+
+static uint64_t romHash(const uint16_t *words) {
+    // FNV-1a, over the words rather than the bytes
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (uint32_t i = 0; i < kRomWords; i++) {
+        h ^= words[i];
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+static RomImage *romAllocate() {
+    // C++11 new doesn't honour alignas beyond the default
+    void *p;
+#ifndef _WIN32
+    if (posix_memalign(&p, alignof(RomImage), sizeof(RomImage))) return nullptr;
+#else
+    p = _aligned_malloc(sizeof(RomImage), alignof(RomImage));
+    if (!p) return nullptr;
+#endif
+    return new (p) RomImage;
+}
+
+static void romDeallocate(RomImage *image) {
+#ifndef _WIN32
+    free(image);
+#else
+    _aligned_free(image);
+#endif
+}
+
+const RomImage *romBuiltin() {
+    // copied into the cache on first use rather than at load time, and the
+    // reference taken here is never dropped
+    static const RomImage *builtin = romShare(rom);
+    return builtin;
+}
+
+const RomImage *romShare(const uint16_t *words) {
+    uint64_t hash = romHash(words);
+
+    std::lock_guard<std::mutex> lock(cache_lock);
+    std::vector<RomImage *> &images = cache();
+    for (size_t i = 0; i < images.size(); i++) {
+        if (images[i]->hash == hash && !memcmp(images[i]->words, words, kRomBytes)) {
+            images[i]->refs++;
+            return images[i];
+        }
+    }
+
+    RomImage *image = romAllocate();
+    if (!image) return nullptr;
+    memcpy(image->words, words, kRomBytes);
+    image->hash = hash;
+    image->refs = 1;
+    images.push_back(image);
+    return image;
+}
+
+const RomImage *romLoad(const char *path, RomFormat format) {
+    uint16_t words[kRomWords];
+    bool ok = false;
+
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return nullptr;
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            ok = romDecode((const uint8_t *)data, st.st_size, format, words);
+            munmap(data, st.st_size);
+        }
+    }
+    close(fd);
+#else
+    FILE *f = fopen(path, "rb");
+    if (f) {
+        // one byte more than the biggest valid file, to catch oversized ones
+        uint8_t data[kRomMagicSize + kRomBytes + 1];
+        size_t size = fread(data, 1, sizeof(data), f);
+        ok = romDecode(data, size, format, words);
+        fclose(f);
+    }
+#endif
+
+    return ok ? romShare(words) : nullptr;
+}
+
+const RomImage *romRetain(const RomImage *image) {
+    if (!image) return nullptr;
+
+    std::lock_guard<std::mutex> lock(cache_lock);
+    const_cast<RomImage *>(image)->refs++;
+    return image;
+}
+
+void romFree(const RomImage *image) {
+    if (!image) return;
+
+    std::lock_guard<std::mutex> lock(cache_lock);
+    RomImage *entry = const_cast<RomImage *>(image);
+    if (--entry->refs > 0) return;
+
+    std::vector<RomImage *> &images = cache();
+    for (size_t i = 0; i < images.size(); i++) {
+        if (images[i] == entry) {
+            images.erase(images.begin() + i);
+            break;
+        }
+    }
+    entry->~RomImage();
+    romDeallocate(entry);
+}
@@ -0,0 +1,79 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_ROMIMAGE_HPP
+#define BARRVERB_ROMIMAGE_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 64 programs of 128 words
+static const uint32_t kRomWords = 8192;
+static const uint32_t kRomBytes = kRomWords * 2;
+
+// an already-permuted image starts with this, followed by the words little-endian
+#define ROM_IMAGE_MAGIC "BARRROM1"
+static const uint32_t kRomMagicSize = 8;
+
+enum RomFormat {
+    kRomAuto,      // permuted if it has the magic, otherwise a raw dump
+    kRomRaw,       // straight EPROM dump, low byte of each word first
+    kRomPermuted,  // already "prefetched", as in rom.h
+};
+
+// A DSP program ROM, ready for the engine to run
+// The words have had the opcode/offset "prefetch" permutation applied so
+// that word 0 of each program carries the opcode from word 126 and the
+// offset from word 127, just like rom.h
+// Images are immutable and shared between every instance in the process,
+// each program starts on its own cache line
+struct alignas(64) RomImage {
+    uint16_t words[kRomWords];
+
+    uint64_t hash;
+    int refs;  // only touched with the cache lock held
+
+    const uint16_t *program(uint8_t index) const { return words + ((index & 0x3f) << 7); }
+};
+
+// the ROM compiled into the plugin, never freed
+// This keeps a reference of its own, so it can be used without taking one,
+// but anything that releases images with romFree() has to romRetain() it
+const RomImage *romBuiltin();
+
+// turn a raw dump into the permuted layout
+void romPermute(const uint16_t *raw, uint16_t *out);
+
+// decode and validate a ROM file already in memory, false if it isn't one
+bool romDecode(const uint8_t *data, size_t size, RomFormat format, uint16_t *words);
+
+// Look up permuted words in the process-wide cache, adding them if they're
+// new, and take a reference on the shared image
+// Every image returned by romShare(), romLoad() or romRetain() needs a
+// matching romFree()
+// These take a lock, so keep them off the audio thread
+const RomImage *romShare(const uint16_t *words);
+
+// map a ROM file and decode it, or nullptr if it can't be used
+const RomImage *romLoad(const char *path, RomFormat format = kRomAuto);
+
+// another reference on an image that's already held, returned for convenience
+const RomImage *romRetain(const RomImage *image);
+void romFree(const RomImage *image);
+
+#endif  // BARRVERB_ROMIMAGE_HPP
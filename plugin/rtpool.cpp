@@ -0,0 +1,126 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "rtpool.hpp"
+
+#if !defined(_WIN32)
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+#if defined(_WIN32)
+Semaphore::Semaphore() { sem = CreateSemaphore(nullptr, 0, 0x7fffffff, nullptr); }
+Semaphore::~Semaphore() { CloseHandle(sem); }
+void Semaphore::post() { ReleaseSemaphore(sem, 1, nullptr); }
+void Semaphore::wait() { WaitForSingleObject(sem, INFINITE); }
+bool Semaphore::wait(uint32_t ms) { return WaitForSingleObject(sem, ms) == WAIT_OBJECT_0; }
+#elif defined(__APPLE__)
+Semaphore::Semaphore() { sem = dispatch_semaphore_create(0); }
+Semaphore::~Semaphore() { dispatch_release(sem); }
+void Semaphore::post() { dispatch_semaphore_signal(sem); }
+void Semaphore::wait() { dispatch_semaphore_wait(sem, DISPATCH_TIME_FOREVER); }
+bool Semaphore::wait(uint32_t ms) {
+    return dispatch_semaphore_wait(sem, dispatch_time(DISPATCH_TIME_NOW, (int64_t)ms * 1000000)) == 0;
+}
+#else
+Semaphore::Semaphore() { sem_init(&sem, 0, 0); }
+Semaphore::~Semaphore() { sem_destroy(&sem); }
+void Semaphore::post() { sem_post(&sem); }
+void Semaphore::wait() {
+    while (sem_wait(&sem) != 0) {
+        // interrupted by a signal, go back to sleep
+    }
+}
+bool Semaphore::wait(uint32_t ms) {
+    // sem_timedwait() wants a time on the realtime clock
+    timespec until;
+    clock_gettime(CLOCK_REALTIME, &until);
+    until.tv_sec += ms / 1000;
+    until.tv_nsec += (ms % 1000) * 1000000;
+    if (until.tv_nsec >= 1000000000) {
+        until.tv_sec++;
+        until.tv_nsec -= 1000000000;
+    }
+    while (sem_timedwait(&sem, &until) != 0) {
+        if (errno != EINTR) return false;
+    }
+    return true;
+}
+#endif
+
+// best effort, most systems won't allow it without the right permissions,
+// in which case the workers just run at normal priority
+void raisePriority() {
+#if defined(_WIN32)
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL);
+#else
+    sched_param param = {};
+    param.sched_priority = (sched_get_priority_min(SCHED_FIFO) + sched_get_priority_max(SCHED_FIFO)) / 2;
+    pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+#endif
+}
+
+RtWorkerPool::RtWorkerPool(uint32_t threads) {
+    for (uint32_t i = 0; i < threads; i++) {
+        Worker *w = new Worker;
+        w->thread = std::thread(&RtWorkerPool::work, this, w);
+        workers.push_back(w);
+    }
+}
+
+RtWorkerPool::~RtWorkerPool() {
+    quit = true;
+    for (size_t i = 0; i < workers.size(); i++) workers[i]->go.post();
+    for (size_t i = 0; i < workers.size(); i++) {
+        workers[i]->thread.join();
+        delete workers[i];
+    }
+}
+
+void RtWorkerPool::run(uint32_t count, Job job, void *ctx) {
+    this->job = job;
+    this->ctx = ctx;
+    this->count = count;
+    next.store(0, std::memory_order_relaxed);
+
+    // no point waking more workers than there are jobs to share
+    uint32_t helpers = count ? count - 1 : 0;
+    if (helpers > workers.size()) helpers = workers.size();
+    for (uint32_t i = 0; i < helpers; i++) workers[i]->go.post();
+
+    drain();
+    for (uint32_t i = 0; i < helpers; i++) done.wait();
+}
+
+void RtWorkerPool::drain() {
+    uint32_t i;
+    while ((i = next.fetch_add(1, std::memory_order_relaxed)) < count) job(ctx, i);
+}
+
+void RtWorkerPool::work(Worker *w) {
+    raisePriority();
+
+    for (;;) {
+        w->go.wait();
+        if (quit) return;
+        drain();
+        done.post();
+    }
+}
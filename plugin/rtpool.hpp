@@ -0,0 +1,105 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_RTPOOL_HPP
+#define BARRVERB_RTPOOL_HPP
+
+#include <stdint.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <dispatch/dispatch.h>
+#else
+#include <semaphore.h>
+#endif
+
+// A counting semaphore, which is the one thing that can wake another thread
+// without the waker taking a lock
+class Semaphore {
+   public:
+    Semaphore();
+    ~Semaphore();
+
+    void post();
+    void wait();
+    bool wait(uint32_t ms);  // false if it timed out
+
+   private:
+    Semaphore(const Semaphore &) = delete;
+    Semaphore &operator=(const Semaphore &) = delete;
+
+#if defined(_WIN32)
+    HANDLE sem;
+#elif defined(__APPLE__)
+    dispatch_semaphore_t sem;
+#else
+    sem_t sem;
+#endif
+};
+
+// Gives the calling thread realtime priority if the system allows it
+void raisePriority();
+
+// Worker threads for sharing one block's work out from the audio thread
+// Unlike WorkerPool, run() never takes a lock or allocates, the workers sleep
+// on semaphores in between blocks and are given realtime priority if the
+// system allows it
+// Only one thread may call run() at a time
+class RtWorkerPool {
+   public:
+    typedef void (*Job)(void *ctx, uint32_t index);
+
+    // threads is the number of workers, not counting the caller of run()
+    explicit RtWorkerPool(uint32_t threads);
+    ~RtWorkerPool();
+
+    uint32_t size() const { return workers.size(); }
+
+    // call job(ctx, i) for every i below count, returning when they're all done
+    void run(uint32_t count, Job job, void *ctx);
+
+   private:
+    RtWorkerPool(const RtWorkerPool &) = delete;
+    RtWorkerPool &operator=(const RtWorkerPool &) = delete;
+
+    struct Worker {
+        std::thread thread;
+        Semaphore go;
+    };
+
+    void work(Worker *w);
+    void drain();
+
+    std::vector<Worker *> workers;
+    Semaphore done;
+
+    // written by run() before the workers are woken
+    Job job = nullptr;
+    void *ctx = nullptr;
+    uint32_t count = 0;
+    bool quit = false;
+
+    std::atomic<uint32_t> next{0};
+};
+
+#endif  // BARRVERB_RTPOOL_HPP
@@ -0,0 +1,387 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "scheduler.hpp"
+
+#include <string.h>
+
+// Stealing
+
+StealDeque::StealDeque(uint32_t capacity) {
+    uint32_t size = 1;
+    while (size < capacity) size <<= 1;
+    items = new std::atomic<uint32_t>[size];
+    mask = size - 1;
+}
+
+StealDeque::~StealDeque() {
+    delete[] items;
+}
+
+void StealDeque::clear() {
+    top.store(0, std::memory_order_relaxed);
+    bottom.store(0, std::memory_order_relaxed);
+}
+
+bool StealDeque::push(uint32_t item) {
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
+    if (b - t > (int64_t)mask) return false;  // full, it never grows
+
+    items[b & mask].store(item, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+}
+
+bool StealDeque::take(uint32_t &item) {
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        // already empty
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    item = items[b & mask].load(std::memory_order_relaxed);
+    if (t == b) {
+        // the last one, which a thief might be after as well
+        bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return won;
+    }
+    return true;
+}
+
+bool StealDeque::steal(uint32_t &item) {
+    int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom.load(std::memory_order_acquire);
+    if (t >= b) return false;
+
+    item = items[t & mask].load(std::memory_order_relaxed);
+    return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+}
+
+// Scheduling
+
+StreamScheduler::StreamScheduler(uint32_t streams, uint32_t threads) : threads(threads) {
+    image = romBuiltin();
+
+    // each key has at most one batch that isn't full
+    capacity = (streams + kLanes - 1) / kLanes + kKeys;
+    if (capacity > streams) capacity = streams;
+    // but most of the time they're bunched up on far fewer programs, so only
+    // enough for them all packed into full batches are mapped to begin with
+    first = (streams + kLanes - 1) / kLanes + kSpare;
+    if (first > capacity) first = capacity;
+
+    batch_key.resize(capacity);
+    batch_prev.resize(capacity);
+    batch_used.resize(capacity);
+    lane_stream.resize(capacity * kLanes);
+    stream_slot.resize(streams);
+    free_batches.reserve(capacity);
+
+    inL.resize(capacity * kLanes);
+    inR.resize(capacity * kLanes);
+    outL.resize(capacity * kLanes);
+    outR.resize(capacity * kLanes);
+    for (uint32_t i = 0; i <= threads; i++) deques.push_back(new StealDeque(capacity));
+
+    moving = new EngineSnapshot;
+    filling = new EngineSnapshot;
+}
+
+StreamScheduler::~StreamScheduler() {
+    deactivate();
+    for (size_t i = 0; i < deques.size(); i++) delete deques[i];
+    delete moving;
+    delete filling;
+}
+
+bool StreamScheduler::activate() {
+    if (batches) return true;
+
+    // the rest are left unmapped until reserve() needs them
+    batches = new EngineBatch[capacity];
+    for (uint32_t b = 0; b < capacity; b++) {
+        batches[b].setSampleRate(sample_rate);
+        batches[b].setRom(image);
+        if (b < first && !batches[b].activate()) {
+            deactivate();
+            return false;
+        }
+    }
+
+    // no streams to begin with
+    free_batches.clear();
+    for (uint32_t b = capacity; b--;) {
+        batch_key[b] = -1;
+        batch_used[b] = 0;
+        if (b < first) free_batches.push_back(b);
+    }
+    for (size_t i = 0; i < lane_stream.size(); i++) lane_stream[i] = -1;
+    for (size_t i = 0; i < stream_slot.size(); i++) stream_slot[i] = -1;
+    for (uint32_t k = 0; k < kKeys; k++) key_tail[k] = -1;
+    batches_used = keys_used = 0;
+    parity = 0;
+
+    // anything left over from last time was unmapped along with the rest
+    uint32_t b;
+    while (fresh.pop(b)) continue;
+    mapped = first;
+    wanted.store(first, std::memory_order_relaxed);
+
+    if (threads && !pool) pool = new RtWorkerPool(threads);
+    return true;
+}
+
+void StreamScheduler::deactivate() {
+    delete pool;
+    pool = nullptr;
+    delete[] batches;
+    batches = nullptr;
+}
+
+void StreamScheduler::setSampleRate(float rate) {
+    sample_rate = rate;
+    if (!batches) return;
+
+    for (uint32_t b = 0; b < capacity; b++) batches[b].setSampleRate(rate);
+}
+
+void StreamScheduler::setRom(const RomImage *rom) {
+    image = rom;
+    if (!batches) return;
+
+    for (uint32_t b = 0; b < capacity; b++) batches[b].setRom(rom);
+}
+
+bool StreamScheduler::reserve() {
+    if (!batches) return false;
+
+    uint32_t target = wanted.load(std::memory_order_relaxed);
+    if (target > capacity) target = capacity;
+    while (mapped < target && !fresh.full()) {
+        if (!batches[mapped].activate()) return false;
+        fresh.push(mapped++);
+    }
+    return true;
+}
+
+// whatever reserve() has mapped since last time
+void StreamScheduler::pickUp() {
+    uint32_t b;
+    while (fresh.pop(b)) free_batches.push_back(b);
+}
+
+// a free lane in the key's last batch, or in a fresh one if that's full
+int32_t StreamScheduler::place(uint32_t key) {
+    int32_t b = key_tail[key];
+    if (b < 0 || batch_used[b] == kLanes) {
+        if (free_batches.empty()) pickUp();
+        if (free_batches.empty()) return -1;
+        b = free_batches.back();
+        free_batches.pop_back();
+
+        if (key_tail[key] < 0) keys_used++;
+        batches_used++;
+        wanted.store(batches_used + keys_used + kSpare, std::memory_order_relaxed);
+
+        batch_key[b] = key;
+        batch_prev[b] = key_tail[key];
+        key_tail[key] = b;
+        batches[b].setProgram(key >> 1);
+        batches[b].setPhase((key & 1) ^ parity);
+    }
+
+    for (uint32_t l = 0; l < kLanes; l++) {
+        if (lane_stream[b * kLanes + l] < 0) {
+            batch_used[b]++;
+            return b * kLanes + l;
+        }
+    }
+    return -1;
+}
+
+// free up a lane, filling the gap from the key's last batch so that the
+// others stay full
+void StreamScheduler::vacate(int32_t slot) {
+    uint32_t b = slot / kLanes;
+    uint32_t key = batch_key[b];
+    int32_t tail = key_tail[key];
+
+    if ((int32_t)b != tail) {
+        int32_t from = -1;
+        for (uint32_t l = kLanes; l--;) {
+            if (lane_stream[tail * kLanes + l] >= 0) {
+                from = tail * kLanes + l;
+                break;
+            }
+        }
+
+        int32_t stream = lane_stream[from];
+        batches[tail].captureLane(from % kLanes, *filling);
+        batches[b].applyLane(slot % kLanes, *filling);
+        lane_stream[slot] = stream;
+        stream_slot[stream] = slot;
+
+        slot = from;
+        b = tail;
+    }
+
+    lane_stream[slot] = -1;
+    if (--batch_used[b] == 0) {
+        key_tail[key] = batch_prev[b];
+        batch_key[b] = -1;
+        free_batches.push_back(b);
+
+        if (key_tail[key] < 0) keys_used--;
+        batches_used--;
+        wanted.store(batches_used + keys_used + kSpare, std::memory_order_relaxed);
+    }
+}
+
+int32_t StreamScheduler::addStream(uint8_t program) {
+    if (!batches) return -1;
+
+    int32_t stream = -1;
+    for (uint32_t s = 0; s < stream_slot.size(); s++) {
+        if (stream_slot[s] < 0) {
+            stream = s;
+            break;
+        }
+    }
+    if (stream < 0) return -1;
+
+    // a new stream starts on an even sample, like a freshly reset engine
+    int32_t slot = place((program & 0x3f) << 1 | parity);
+    if (slot < 0) return -1;
+
+    batches[slot / kLanes].clearLane(slot % kLanes);
+    lane_stream[slot] = stream;
+    stream_slot[stream] = slot;
+    return stream;
+}
+
+void StreamScheduler::removeStream(uint32_t stream) {
+    if (!batches || stream >= stream_slot.size() || stream_slot[stream] < 0) return;
+
+    vacate(stream_slot[stream]);
+    stream_slot[stream] = -1;
+}
+
+void StreamScheduler::moveStream(uint32_t stream, uint8_t program) {
+    int32_t slot = stream_slot[stream];
+    uint32_t b = slot / kLanes;
+
+    batches[b].captureLane(slot % kLanes, *moving);
+    uint32_t from = batch_key[b];
+    uint32_t key = (program & 0x3f) << 1 | (from & 1);
+    vacate(slot);
+
+    // With no batch free for the new program, the stream goes back to its
+    // old one, which there's always room for since it's just given up its
+    // lane, and tries again next period
+    slot = place(key);
+    if (slot < 0) slot = place(from);
+    batches[slot / kLanes].applyLane(slot % kLanes, *moving);
+    lane_stream[slot] = stream;
+    stream_slot[stream] = slot;
+}
+
+void StreamScheduler::run(const StreamJob *jobs, uint32_t count, uint32_t frames) {
+    if (!batches) {
+        for (uint32_t j = 0; j < count; j++) {
+            memset(jobs[j].outL, 0, sizeof(float) * frames);
+            memset(jobs[j].outR, 0, sizeof(float) * frames);
+        }
+        return;
+    }
+
+    // program changes first, since they can move other streams about
+    for (uint32_t j = 0; j < count; j++) {
+        uint32_t s = jobs[j].stream;
+        if (s >= stream_slot.size() || stream_slot[s] < 0) continue;
+        if (batches[stream_slot[s] / kLanes].getProgram() != (jobs[j].program & 0x3f)) {
+            moveStream(s, jobs[j].program);
+        }
+    }
+
+    for (size_t i = 0; i < inL.size(); i++) {
+        inL[i] = inR[i] = nullptr;
+        outL[i] = outR[i] = nullptr;
+    }
+    for (uint32_t j = 0; j < count; j++) {
+        uint32_t s = jobs[j].stream;
+        if (s >= stream_slot.size() || stream_slot[s] < 0) {
+            memset(jobs[j].outL, 0, sizeof(float) * frames);
+            memset(jobs[j].outR, 0, sizeof(float) * frames);
+            continue;
+        }
+        int32_t slot = stream_slot[s];
+        inL[slot] = jobs[j].inL;
+        inR[slot] = jobs[j].inR;
+        outL[slot] = jobs[j].outL;
+        outR[slot] = jobs[j].outR;
+    }
+
+    // deal the batches out, every one in use runs whether it has jobs or not
+    for (size_t d = 0; d < deques.size(); d++) deques[d]->clear();
+    uint32_t n = 0;
+    for (uint32_t b = 0; b < capacity; b++) {
+        if (batch_key[b] >= 0) deques[n++ % deques.size()]->push(b);
+    }
+
+    this->frames = frames;
+    unclaimed.store(n, std::memory_order_relaxed);
+    if (pool) {
+        pool->run(deques.size(), work, this);
+    } else {
+        work(this, 0);
+    }
+
+    parity ^= frames & 1;
+}
+
+void StreamScheduler::work(void *ctx, uint32_t index) {
+    StreamScheduler *self = (StreamScheduler *)ctx;
+    const uint32_t count = self->deques.size();
+    StealDeque *own = self->deques[index];
+    uint32_t b;
+
+    // anything left unclaimed is in somebody's deque, so keep looking until
+    // it's all been claimed
+    while (self->unclaimed.load(std::memory_order_acquire)) {
+        bool got = own->take(b);
+        for (uint32_t i = 1; !got && i < count; i++) got = self->deques[(index + i) % count]->steal(b);
+        if (!got) continue;
+
+        self->unclaimed.fetch_sub(1, std::memory_order_acq_rel);
+        self->runBatch(b);
+    }
+}
+
+void StreamScheduler::runBatch(uint32_t b) {
+    const uint32_t first = b * kLanes;
+    batches[b].run(&inL[first], &inR[first], &outL[first], &outR[first], kLanes, frames);
+}
@@ -0,0 +1,172 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_SCHEDULER_HPP
+#define BARRVERB_SCHEDULER_HPP
+
+#include <stdint.h>
+
+#include <atomic>
+#include <vector>
+
+#include "batch.hpp"
+#include "ringbuffer.hpp"
+#include "rtpool.hpp"
+
+// Fixed-size work-stealing deque, after Chase and Lev, with the memory
+// ordering from Le et al., "Correct and Efficient Work-Stealing for Weak
+// Memory Models"
+// The owner pushes and takes at the bottom, any other thread steals from the
+// top, and nobody ever blocks or allocates
+class StealDeque {
+   public:
+    explicit StealDeque(uint32_t capacity);
+    ~StealDeque();
+
+    // only while nobody else is using it
+    void clear();
+
+    // owner side
+    bool push(uint32_t item);
+    bool take(uint32_t &item);
+
+    // any thread
+    bool steal(uint32_t &item);
+
+   private:
+    StealDeque(const StealDeque &) = delete;
+    StealDeque &operator=(const StealDeque &) = delete;
+
+    std::atomic<int64_t> top{0};
+    char pad_top[64 - sizeof(std::atomic<int64_t>)];
+    std::atomic<int64_t> bottom{0};
+    char pad_bottom[64 - sizeof(std::atomic<int64_t>)];
+
+    std::atomic<uint32_t> *items;
+    uint32_t mask;
+};
+
+// One stream's share of a period
+struct StreamJob {
+    uint32_t stream;
+    uint8_t program;  // 0 to 63
+    const float *inL, *inR;
+    float *outL, *outR;
+};
+
+// Runs lots of independent streams, a period at a time, across cores
+// Streams with the same program share an EngineBatch, one to a lane, so one
+// pass through the microcode runs eight of them, and the batches are dealt
+// out to the threads' deques, with idle threads stealing from busy ones
+// A stream changing program is moved to a batch running the new one, with
+// its reverb tail intact
+// Only enough batches for the streams packed eight to a batch are mapped to
+// begin with, and reserve() maps more as the programs spread out
+// Nothing in run() locks or allocates
+class StreamScheduler {
+   public:
+    // threads is the number of workers, not counting the caller of run()
+    StreamScheduler(uint32_t streams, uint32_t threads);
+    ~StreamScheduler();
+
+    // maps the first batches and starts the workers
+    bool activate();
+    void deactivate();
+    bool isActive() const { return batches != nullptr; }
+
+    void setSampleRate(float rate);
+    void setRom(const RomImage *image);  // not copied, must outlive its use
+
+    // Maps enough batches for one more per program and phase in use, from
+    // any thread but the audio thread, or between periods, but not at the
+    // same time as activate(), setSampleRate() or setRom()
+    // Call it regularly, since a stream whose new program has no batch free
+    // carries on with its old one until there is, false if it couldn't map
+    bool reserve();
+
+    // Streams are added and removed between periods, from the thread that
+    // calls run() or while it isn't running
+    // addStream() gives a new, silent stream, or -1 if they're all in use or
+    // there isn't a batch free for it until reserve() has been called
+    int32_t addStream(uint8_t program);
+    void removeStream(uint32_t stream);
+    uint32_t maxStreams() const { return stream_slot.size(); }
+
+    // Run every stream for a period, returning when they're all done
+    // A stream without a job in this period is fed silence so that it stays
+    // in step, and its output is thrown away
+    void run(const StreamJob *jobs, uint32_t count, uint32_t frames);
+
+   private:
+    StreamScheduler(const StreamScheduler &) = delete;
+    StreamScheduler &operator=(const StreamScheduler &) = delete;
+
+    static const uint32_t kLanes = EngineBatch::kLanes;
+    // batches are kept per program and per phase, since a batch's lanes all
+    // run on the same sample
+    static const uint32_t kKeys = 128;
+    // mapped over and above one for each key in use
+    static const uint32_t kSpare = 8;
+
+    int32_t place(uint32_t key);
+    void pickUp();
+    void vacate(int32_t slot);
+    void moveStream(uint32_t stream, uint8_t program);
+
+    static void work(void *ctx, uint32_t index);
+    void runBatch(uint32_t b);
+
+    uint32_t threads;
+    uint32_t capacity;  // the most batches any mix of programs can need
+    uint32_t first;     // how many are mapped on activate()
+    float sample_rate = 48000;
+    const RomImage *image;
+
+    EngineBatch *batches = nullptr;
+    RtWorkerPool *pool = nullptr;
+
+    // Each key's batches are chained from the last one added, and all of
+    // them but that one are kept full, so there are never more batches in
+    // use than the streams need
+    std::vector<int16_t> batch_key;    // -1 when free
+    std::vector<int32_t> batch_prev;   // the key's batch before this one
+    std::vector<uint8_t> batch_used;   // lanes in use
+    std::vector<int32_t> lane_stream;  // batch * kLanes + lane, -1 when free
+    std::vector<int32_t> stream_slot;  // the other way round
+    std::vector<uint32_t> free_batches;  // mapped but not in use
+    int32_t key_tail[kKeys];
+    uint32_t batches_used = 0, keys_used = 0;
+    uint8_t parity = 0;  // of the frames run so far
+
+    // batches mapped by reserve(), on their way to the audio thread
+    uint32_t mapped = 0;  // reserve()'s side
+    std::atomic<uint32_t> wanted{0};
+    RingBuffer<uint32_t, 256> fresh;
+
+    // for moving streams around, one on its way and one filling a gap
+    EngineSnapshot *moving = nullptr, *filling = nullptr;
+
+    // the current period
+    std::vector<const float *> inL, inR;
+    std::vector<float *> outL, outR;
+    std::vector<StealDeque *> deques;
+    std::atomic<uint32_t> unclaimed{0};
+    uint32_t frames = 0;
+};
+
+#endif  // BARRVERB_SCHEDULER_HPP
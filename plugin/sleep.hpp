@@ -0,0 +1,108 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_SLEEP_HPP
+#define BARRVERB_SLEEP_HPP
+
+#include <stdint.h>
+#include <string.h>
+
+#include "arena.hpp"
+
+// The decay time in a program's name, ".6 Sec Small Bright" or
+// "Gated - 250ms", in seconds
+// Parsed by hand, since strtof() would want a comma in some locales
+static inline float programDecay(const char *name) {
+    const char *p = name;
+    while (*p && !(*p >= '0' && *p <= '9') && !(*p == '.' && p[1] >= '0' && p[1] <= '9')) p++;
+
+    float value = 0, scale = 0;
+    for (; (*p >= '0' && *p <= '9') || *p == '.'; p++) {
+        if (*p == '.') {
+            scale = 1;
+        } else if (scale) {
+            scale /= 10;
+            value += (*p - '0') * scale;
+        } else {
+            value = value * 10 + (*p - '0');
+        }
+    }
+    return strstr(p, "ms") ? value / 1000 : value;
+}
+
+// Stops an engine running once it has been fed silence for longer than its
+// program takes to die away, and its output has gone quiet, so instances on
+// silent tracks cost next to nothing
+// While it's asleep the engine's state is left as it was, and it picks up
+// from there as soon as there's input again
+// "Silence" is anything that wouldn't make it past the 12-bit ADC, and
+// "quiet" is no more than the last bit of the DAC
+class SleepGate {
+   public:
+    // the RAM is long enough to hold a sound for a while before any of it
+    // comes out, and the program only runs on every other frame
+    void setTail(float seconds, float rate) { tail = seconds * rate + 2 * kRamWords; }
+
+    void wake() {
+        asleep = false;
+        silent_frames = quiet_frames = 0;
+    }
+
+    // with silence going in, the engine needn't run at all
+    bool isAsleep() const { return asleep; }
+
+    static bool silent(const float *in, uint32_t frames) {
+        for (uint32_t i = 0; i < frames; i++) {
+            if (in[i] > kSilence || in[i] < -kSilence) return false;
+        }
+        return true;
+    }
+
+    static bool quiet(const float *out, uint32_t frames) {
+        for (uint32_t i = 0; i < frames; i++) {
+            if (out[i] > kQuiet || out[i] < -kQuiet) return false;
+        }
+        return true;
+    }
+
+    // after each block that's been run, whether its input was silent and
+    // its output quiet
+    // The integer maths can leave a program circulating a bit or two for
+    // ever, so the output has to stay quiet for a whole trip round the RAM
+    // before it counts
+    void update(bool input_silent, bool output_quiet, uint32_t frames) {
+        if (!input_silent) {
+            wake();
+            return;
+        }
+        silent_frames += frames;
+        quiet_frames = output_quiet ? quiet_frames + frames : 0;
+        if (silent_frames >= tail && quiet_frames >= 2 * kRamWords) asleep = true;
+    }
+
+   private:
+    static constexpr float kSilence = 1.0f / 8192;
+    static constexpr float kQuiet = 1.0f / 2048;
+
+    uint64_t tail = 2 * kRamWords;
+    uint64_t silent_frames = 0;
+    uint64_t quiet_frames = 0;
+    bool asleep = false;
+};
+
+#endif  // BARRVERB_SLEEP_HPP
@@ -0,0 +1,147 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "snapshot.hpp"
+
+#include <string.h>
+
+// Layout, all little-endian:
+//   "BVS2"
+//   acc, ptr, held_l, held_r as 16-bit words, phase as a byte
+//   the four filter states as 32-bit IEEE floats
+//   the number of inputs in the filters' current block as a byte, and then
+//   all eight of the block's inputs as floats
+//   the RAM as a series of 16-bit tokens:
+//     top bit set - repeat the following word (token & 0x7fff) times
+//     top bit clear - the following (token) words are copied as they are
+
+static const uint32_t kMaxRun = 0x7fff;
+
+static uint8_t *put16(uint8_t *p, uint16_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    return p + 2;
+}
+
+static const uint8_t *get16(const uint8_t *p, uint16_t &v) {
+    v = p[0] | p[1] << 8;
+    return p + 2;
+}
+
+static uint8_t *putFloat(uint8_t *p, float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, 4);
+    p = put16(p, bits);
+    return put16(p, bits >> 16);
+}
+
+static const uint8_t *getFloat(const uint8_t *p, float &f) {
+    uint16_t lo, hi;
+    p = get16(p, lo);
+    p = get16(p, hi);
+    uint32_t bits = lo | (uint32_t)hi << 16;
+    memcpy(&f, &bits, 4);
+    return p;
+}
+
+size_t snapshotEncode(const EngineSnapshot &snap, uint8_t *out) {
+    uint8_t *p = out;
+
+    memcpy(p, "BVS2", 4);
+    p += 4;
+    p = put16(p, snap.acc);
+    p = put16(p, snap.ptr);
+    p = put16(p, snap.held_l);
+    p = put16(p, snap.held_r);
+    *p++ = snap.phase;
+    for (int i = 0; i < 4; i++) p = putFloat(p, snap.filter[i]);
+    *p++ = snap.filter_fill;
+    for (uint32_t i = 0; i < Cascade::kSteps; i++) p = putFloat(p, snap.filter_in[i]);
+
+    const int16_t *ram = snap.ram;
+    uint32_t i = 0;
+    while (i < kRamWords) {
+        // how long is the run starting here?
+        uint32_t run = 1;
+        while (i + run < kRamWords && run < kMaxRun && ram[i + run] == ram[i]) run++;
+
+        // runs of two don't save anything over literals
+        if (run > 2) {
+            p = put16(p, 0x8000 | run);
+            p = put16(p, ram[i]);
+            i += run;
+            continue;
+        }
+
+        // gather literals until the next run worth encoding
+        uint32_t start = i;
+        while (i < kRamWords && i - start < kMaxRun) {
+            if (i + 2 < kRamWords && ram[i] == ram[i + 1] && ram[i] == ram[i + 2]) break;
+            i++;
+        }
+        p = put16(p, i - start);
+        for (uint32_t j = start; j < i; j++) p = put16(p, ram[j]);
+    }
+
+    return p - out;
+}
+
+bool snapshotDecode(const uint8_t *data, size_t size, EngineSnapshot &snap) {
+    const uint8_t *p = data, *end = data + size;
+    uint16_t v;
+
+    if (size < 4 + 9 + 16 + 1 + 4 * Cascade::kSteps) return false;
+    if (memcmp(p, "BVS2", 4)) return false;
+    p += 4;
+    p = get16(p, v);
+    snap.acc = v;
+    p = get16(p, snap.ptr);
+    p = get16(p, v);
+    snap.held_l = v;
+    p = get16(p, v);
+    snap.held_r = v;
+    snap.phase = *p++ & 1;
+    for (int i = 0; i < 4; i++) p = getFloat(p, snap.filter[i]);
+    snap.filter_fill = *p++ % Cascade::kSteps;
+    for (uint32_t i = 0; i < Cascade::kSteps; i++) p = getFloat(p, snap.filter_in[i]);
+    snap.ptr &= kRamWords - 1;
+
+    uint32_t i = 0;
+    while (i < kRamWords) {
+        uint16_t token;
+        if (end - p < 2) return false;
+        p = get16(p, token);
+
+        uint32_t count = token & kMaxRun;
+        if (count > kRamWords - i) return false;
+
+        if (token & 0x8000) {
+            if (end - p < 2) return false;
+            p = get16(p, v);
+            for (uint32_t j = 0; j < count; j++) snap.ram[i++] = v;
+        } else {
+            if ((size_t)(end - p) < count * 2) return false;
+            for (uint32_t j = 0; j < count; j++) {
+                p = get16(p, v);
+                snap.ram[i++] = v;
+            }
+        }
+    }
+
+    return p == end;
+}
@@ -0,0 +1,51 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_SNAPSHOT_HPP
+#define BARRVERB_SNAPSHOT_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.hpp"
+#include "cascade.hpp"
+
+// The running state of an engine, enough to carry on exactly where it left off
+// Filter coefficients aren't included, so a snapshot can be restored at a
+// different sample rate, and neither is the program, which is a parameter
+struct EngineSnapshot {
+    int16_t ram[kRamWords];
+    float filter[4];                   // z1 and z2 of each input filter stage
+    float filter_in[Cascade::kSteps];  // the input filters' part-finished block
+    uint8_t filter_fill;               // and how much of it there is
+    int16_t acc;
+    uint16_t ptr;
+    uint8_t phase;
+    int16_t held_l, held_r;
+};
+
+// the largest encoded snapshot, when no part of the RAM compresses at all
+static const size_t kSnapshotMaxBytes = 96 + kRamBytes + kRamBytes / 0x7fff * 2 + 2;
+
+// Pack a snapshot down for saving
+// The RAM is run-length encoded, which mostly pays off for reverbs that have
+// been fed silence or haven't been fed at all yet
+size_t snapshotEncode(const EngineSnapshot &snap, uint8_t *out);
+bool snapshotDecode(const uint8_t *data, size_t size, EngineSnapshot &snap);
+
+#endif  // BARRVERB_SNAPSHOT_HPP
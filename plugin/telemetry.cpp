@@ -0,0 +1,210 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "telemetry.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <mutex>
+
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+TelemetrySegment *telemetryMap(const char *name, bool create) {
+#ifdef _WIN32
+    (void)name;
+    (void)create;
+    return nullptr;
+#else
+    int fd = shm_open(name, create ? O_RDWR | O_CREAT : O_RDONLY, 0600);
+    if (fd < 0) return nullptr;
+
+    // whoever gets there first sizes it, which comes out the same whoever it is
+    if (create && ftruncate(fd, sizeof(TelemetrySegment)) != 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    void *mem = mmap(nullptr, sizeof(TelemetrySegment), create ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED,
+                     fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) return nullptr;
+
+    // a new segment is all zeroes, which is every record free, so the header
+    // can be filled in by any number of processes at once
+    TelemetrySegment *segment = (TelemetrySegment *)mem;
+    if (create && segment->magic == 0) {
+        segment->version = kTelemetryVersion;
+        segment->slots = kTelemetrySlots;
+        segment->record_size = sizeof(TelemetryRecord);
+        __atomic_store_n(&segment->magic, kTelemetryMagic, __ATOMIC_RELEASE);
+    }
+
+    if (__atomic_load_n(&segment->magic, __ATOMIC_ACQUIRE) != kTelemetryMagic ||
+        segment->version != kTelemetryVersion || segment->record_size != sizeof(TelemetryRecord)) {
+        munmap(mem, sizeof(TelemetrySegment));
+        return nullptr;
+    }
+    return segment;
+#endif
+}
+
+void telemetryUnmap(TelemetrySegment *segment) {
+#ifndef _WIN32
+    if (segment) munmap(segment, sizeof(TelemetrySegment));
+#endif
+}
+
+bool telemetryRead(const TelemetryRecord &rec, TelemetryValues &v) {
+    for (int tries = 0; tries < 100; tries++) {
+        uint32_t before = rec.seq.load(std::memory_order_acquire);
+        if (before & 1) continue;
+
+        v.owner = rec.owner.load(std::memory_order_relaxed);
+        v.instance = rec.instance.load(std::memory_order_relaxed);
+        v.program = rec.program.load(std::memory_order_relaxed);
+        v.asleep = rec.asleep.load(std::memory_order_relaxed);
+        v.load = rec.load.load(std::memory_order_relaxed);
+        v.peak_load = rec.peak_load.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < LoadMeter::kBins; i++) {
+            v.histogram[i] = rec.histogram[i].load(std::memory_order_relaxed);
+        }
+        v.level_l = rec.level_l.load(std::memory_order_relaxed);
+        v.level_r = rec.level_r.load(std::memory_order_relaxed);
+        v.full_scale = rec.full_scale.load(std::memory_order_relaxed);
+        v.frames = rec.frames.load(std::memory_order_relaxed);
+        v.updated_ns = rec.updated_ns.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (rec.seq.load(std::memory_order_relaxed) == before) return true;
+    }
+    return false;
+}
+
+// The segment is mapped once for the whole process, for as long as any
+// instance has a record in it
+
+static std::mutex segment_lock;
+static TelemetrySegment *segment = nullptr;
+static uint32_t attached = 0;
+static uint32_t instances = 0;
+
+void TelemetryWriter::attach() {
+#ifndef _WIN32
+    if (rec) return;
+    const char *name = getenv("BARRVERB_TELEMETRY");
+    if (!name || !name[0]) return;
+
+    std::lock_guard<std::mutex> lock(segment_lock);
+    if (!segment) segment = telemetryMap(name, true);
+    if (!segment) return;
+
+    // a free record, or one left behind by a process that has gone
+    uint32_t pid = getpid();
+    for (uint32_t i = 0; i < kTelemetrySlots && !rec; i++) {
+        TelemetryRecord &r = segment->records[i];
+        uint32_t owner = r.owner.load(std::memory_order_relaxed);
+        if (owner && (kill(owner, 0) == 0 || errno != ESRCH)) continue;
+        if (r.owner.compare_exchange_strong(owner, pid)) rec = &r;
+    }
+    if (!rec) {
+        if (!attached) {
+            telemetryUnmap(segment);
+            segment = nullptr;
+        }
+        return;
+    }
+    attached++;
+
+    // start it off clean, in case a reader is watching
+    uint32_t seq = rec->seq.load(std::memory_order_relaxed) | 1;
+    rec->seq.store(seq, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    rec->instance.store(++instances, std::memory_order_relaxed);
+    rec->program.store(0, std::memory_order_relaxed);
+    rec->asleep.store(0, std::memory_order_relaxed);
+    rec->load.store(0, std::memory_order_relaxed);
+    rec->peak_load.store(0, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < LoadMeter::kBins; i++) rec->histogram[i].store(0, std::memory_order_relaxed);
+    rec->level_l.store(0, std::memory_order_relaxed);
+    rec->level_r.store(0, std::memory_order_relaxed);
+    rec->full_scale.store(0, std::memory_order_relaxed);
+    rec->frames.store(0, std::memory_order_relaxed);
+    rec->updated_ns.store(0, std::memory_order_relaxed);
+    rec->seq.store(seq + 1, std::memory_order_release);
+    full_scale = frames = 0;
+#endif
+}
+
+void TelemetryWriter::detach() {
+    if (!rec) return;
+
+    std::lock_guard<std::mutex> lock(segment_lock);
+    rec->owner.store(0, std::memory_order_release);
+    rec = nullptr;
+    if (--attached == 0) {
+        telemetryUnmap(segment);
+        segment = nullptr;
+    }
+}
+
+void TelemetryWriter::publish(uint8_t program, bool asleep, const LoadMeter &meter, const float *outL,
+                              const float *outR, uint32_t frames) {
+    if (!rec) return;
+
+    // the DAC is 12 bits, so 2047/2048 is as loud as it goes
+    // these are the host's samples, each DAC word is held for two of them,
+    // and a program can get there without the accumulator saturating
+    const float limit = 2047.0f / 2048;
+    float peak_l = 0, peak_r = 0;
+    for (uint32_t i = 0; i < frames; i++) {
+        float l = outL[i] < 0 ? -outL[i] : outL[i];
+        float r = outR[i] < 0 ? -outR[i] : outR[i];
+        if (l > peak_l) peak_l = l;
+        if (r > peak_r) peak_r = r;
+        full_scale += (l >= limit) + (r >= limit);
+    }
+    this->frames += frames;
+
+    uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                       .count();
+
+    // a seqlock, readers retry if seq was odd or changed while they read
+    uint32_t seq = rec->seq.load(std::memory_order_relaxed);
+    rec->seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    rec->program.store(program, std::memory_order_relaxed);
+    rec->asleep.store(asleep, std::memory_order_relaxed);
+    rec->load.store(meter.getLoad(), std::memory_order_relaxed);
+    rec->peak_load.store(meter.getPeak(), std::memory_order_relaxed);
+    for (uint32_t i = 0; i < LoadMeter::kBins; i++) rec->histogram[i].store(meter.getBin(i), std::memory_order_relaxed);
+    rec->level_l.store(peak_l, std::memory_order_relaxed);
+    rec->level_r.store(peak_r, std::memory_order_relaxed);
+    rec->full_scale.store(full_scale, std::memory_order_relaxed);
+    rec->frames.store(this->frames, std::memory_order_relaxed);
+    rec->updated_ns.store(now, std::memory_order_relaxed);
+    rec->seq.store(seq + 2, std::memory_order_release);
+}
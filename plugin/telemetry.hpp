@@ -0,0 +1,106 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_TELEMETRY_HPP
+#define BARRVERB_TELEMETRY_HPP
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "loadmeter.hpp"
+
+// Live stats for external monitors, in a POSIX shared-memory segment
+// With BARRVERB_TELEMETRY set to a segment name, "/barrverb" say, when the
+// host starts, every instance in every process claims a record in it, and
+// tools/monitor.cpp shows them all
+// The audio thread publishes to its record through a seqlock, which is
+// nothing but stores to memory it already has mapped, so there's no IPC on
+// the realtime path and a reader can never hold it up
+// Not available on Windows, where attach() does nothing
+
+static const uint32_t kTelemetryMagic = 0x54525642;  // "BVRT"
+static const uint32_t kTelemetryVersion = 2;
+static const uint32_t kTelemetrySlots = 1024;
+
+// Everything but owner is written by the one instance that owns it, with
+// seq odd while it's in the middle of an update
+struct alignas(64) TelemetryRecord {
+    std::atomic<uint32_t> owner;  // pid, 0 when the record is free
+    std::atomic<uint32_t> seq;
+
+    std::atomic<uint32_t> instance;  // numbered from 1 within the process
+    std::atomic<uint32_t> program;   // 1 to 64
+    std::atomic<uint32_t> asleep;    // see SleepGate
+    std::atomic<float> load;         // fractions of the time available, as LoadMeter has them
+    std::atomic<float> peak_load;
+    std::atomic<uint32_t> histogram[LoadMeter::kBins];  // blocks in each of LoadMeter's bins
+    std::atomic<float> level_l;  // peak of the last block, 1 is full scale
+    std::atomic<float> level_r;
+    std::atomic<uint64_t> full_scale;  // output samples at full scale, see publish()
+    std::atomic<uint64_t> frames;      // run so far
+    std::atomic<uint64_t> updated_ns;  // steady clock, CLOCK_MONOTONIC on Linux
+};
+
+struct TelemetrySegment {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slots;
+    uint32_t record_size;
+    TelemetryRecord records[kTelemetrySlots];
+};
+
+// One record as it was at some instant
+struct TelemetryValues {
+    uint32_t owner, instance, program, asleep;
+    float load, peak_load, level_l, level_r;
+    uint32_t histogram[LoadMeter::kBins];
+    uint64_t full_scale, frames, updated_ns;
+};
+
+// The segment, created if need be, or nullptr if it can't be had or isn't
+// one of ours
+// A new one can only be opened by the user that created it
+// A reader maps it read-only
+TelemetrySegment *telemetryMap(const char *name, bool create);
+void telemetryUnmap(TelemetrySegment *segment);
+
+// a consistent copy of a record, false if it was being written every time
+bool telemetryRead(const TelemetryRecord &rec, TelemetryValues &values);
+
+// An instance's end of it
+class TelemetryWriter {
+   public:
+    ~TelemetryWriter() { detach(); }
+
+    // claims a record if BARRVERB_TELEMETRY is set
+    // these take a lock and make system calls, so not from the audio thread
+    void attach();
+    void detach();
+
+    // audio thread, once for every run()
+    void publish(uint8_t program, bool asleep, const LoadMeter &meter, const float *outL, const float *outR,
+                 uint32_t frames);
+
+   private:
+    TelemetryRecord *rec = nullptr;
+    uint64_t full_scale = 0;
+    uint64_t frames = 0;
+};
+
+#endif  // BARRVERB_TELEMETRY_HPP
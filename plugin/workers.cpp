@@ -0,0 +1,85 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "workers.hpp"
+
+WorkerPool::WorkerPool(uint32_t threads) {
+    if (!threads) threads = std::thread::hardware_concurrency();
+    for (uint32_t i = 1; i < threads; i++) workers.emplace_back(&WorkerPool::work, this);
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> hold(lock);
+        quit = true;
+    }
+    wake.notify_all();
+    for (size_t i = 0; i < workers.size(); i++) workers[i].join();
+}
+
+void WorkerPool::run(uint32_t count, Job job, void *ctx) {
+    {
+        // a worker that woke up too late for the last batch might still be
+        // looking at it, so wait for it before changing anything
+        std::unique_lock<std::mutex> hold(lock);
+        idle.wait(hold, [this] { return busy == 0; });
+        this->job = job;
+        this->ctx = ctx;
+        this->count = count;
+        next.store(0);
+        finished.store(0);
+        generation++;
+    }
+    wake.notify_all();
+
+    drain(job, ctx, count);
+
+    std::unique_lock<std::mutex> hold(lock);
+    idle.wait(hold, [this, count] { return finished.load() == count && busy == 0; });
+}
+
+void WorkerPool::drain(Job job, void *ctx, uint32_t count) {
+    uint32_t i;
+    while ((i = next.fetch_add(1)) < count) {
+        job(ctx, i);
+        finished.fetch_add(1);
+    }
+}
+
+void WorkerPool::work() {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> hold(lock);
+
+    for (;;) {
+        wake.wait(hold, [this, seen] { return quit || generation != seen; });
+        if (quit) return;
+
+        seen = generation;
+        Job j = job;
+        void *c = ctx;
+        uint32_t n = count;
+        busy++;
+
+        hold.unlock();
+        drain(j, c, n);
+        hold.lock();
+
+        busy--;
+        idle.notify_all();
+    }
+}
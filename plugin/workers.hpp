@@ -0,0 +1,70 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_WORKERS_HPP
+#define BARRVERB_WORKERS_HPP
+
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A fixed set of threads for spreading independent jobs across cores
+// run() hands out job numbers one at a time, so a slow job doesn't hold up
+// the rest, and the calling thread works through them as well
+// This takes locks and sleeps, so it's for offline rendering only
+class WorkerPool {
+   public:
+    typedef void (*Job)(void *ctx, uint32_t index);
+
+    // threads is the total including the caller, 0 for one per core
+    explicit WorkerPool(uint32_t threads = 0);
+    ~WorkerPool();
+
+    uint32_t size() const { return workers.size() + 1; }
+
+    // call job(ctx, i) for every i below count, returning when they're all done
+    void run(uint32_t count, Job job, void *ctx);
+
+   private:
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    void work();
+    void drain(Job job, void *ctx, uint32_t count);
+
+    std::vector<std::thread> workers;
+    std::mutex lock;
+    std::condition_variable wake, idle;
+
+    // the current batch, only changed with the lock held and nobody busy
+    Job job = nullptr;
+    void *ctx = nullptr;
+    uint32_t count = 0;
+    uint64_t generation = 0;
+    uint32_t busy = 0;
+    bool quit = false;
+
+    std::atomic<uint32_t> next{0};
+    std::atomic<uint32_t> finished{0};
+};
+
+#endif  // BARRVERB_WORKERS_HPP
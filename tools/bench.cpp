@@ -0,0 +1,172 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+// Runs every program over the same generated test signal and reports how much
+// faster than realtime each one goes
+// This is also the training workload for the profile-guided release build
+//
+// usage: bench [-s seconds] [-b block] [-r rate] [-n streams] [-q]
+//
+//   -s seconds  of audio for each program, 10 by default
+//   -b block    frames per call to run(), 256 by default
+//   -r rate     sample rate, 48000 by default
+//   -n streams  runs that many streams at once through StreamScheduler
+//               instead, dealing the programs out among them and moving some
+//               to a different program every second
+//   -q          only print the total
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "engine.hpp"
+#include "scheduler.hpp"
+
+static void usage() {
+    fprintf(stderr, "usage: bench [-s seconds] [-b block] [-r rate] [-n streams] [-q]\n");
+    exit(1);
+}
+
+// bursts of noise with silence in between, so the reverb has tails to decay
+// and the filters see the denormal range on the way down
+static void makeSignal(std::vector<float> &left, std::vector<float> &right, uint32_t rate) {
+    uint32_t seed = 1;
+    for (size_t i = 0; i < left.size(); i++) {
+        seed = seed * 1664525 + 1013904223;
+        float noise = (int32_t)seed / 2147483648.0f;
+        float level = (i % rate) < rate / 8 ? 0.5f : 0.0f;
+        left[i] = noise * level;
+        right[i] = -noise * level * 0.7f;
+    }
+}
+
+// every stream gets the same signal, which makes no difference to the work
+static int benchStreams(const std::vector<float> &inL, const std::vector<float> &inR, uint32_t block,
+                        uint32_t rate, uint32_t streams) {
+    // the caller of run() works too, so one worker fewer than cores
+    uint32_t cores = std::thread::hardware_concurrency();
+    StreamScheduler scheduler(streams, cores > 1 ? cores - 1 : 0);
+    scheduler.setSampleRate(rate);
+    if (!scheduler.activate()) {
+        fprintf(stderr, "bench: couldn't allocate DSP RAM\n");
+        return 1;
+    }
+
+    std::vector<StreamJob> jobs(streams);
+    std::vector<float> outL((size_t)streams * block), outR((size_t)streams * block);
+    for (uint32_t s = 0; s < streams; s++) {
+        int32_t stream = scheduler.addStream(s % 64);
+        if (stream < 0 && scheduler.reserve()) stream = scheduler.addStream(s % 64);
+        if (stream < 0) {
+            fprintf(stderr, "bench: couldn't add stream %u\n", s + 1);
+            return 1;
+        }
+        jobs[s].stream = stream;
+        jobs[s].program = s % 64;
+        jobs[s].outL = &outL[(size_t)s * block];
+        jobs[s].outR = &outR[(size_t)s * block];
+    }
+
+    const uint32_t frames = inL.size();
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t done = 0; done < frames; done += block) {
+        uint32_t n = frames - done < block ? frames - done : block;
+
+        // an eighth of the streams move on a program each second
+        bool change = done / rate != (done + n) / rate;
+        for (uint32_t s = 0; s < streams; s++) {
+            if (change && (s + done / rate) % 8 == 0) jobs[s].program = (jobs[s].program + 1) % 64;
+            jobs[s].inL = &inL[done];
+            jobs[s].inR = &inR[done];
+        }
+        scheduler.run(jobs.data(), streams, n);
+        // which a host would do on another thread
+        scheduler.reserve();
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    double seconds = (double)frames / rate;
+    printf("%u streams at once %7.1fx realtime, %.3fs\n", streams, seconds / elapsed, elapsed);
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    double seconds = 10;
+    uint32_t block = 256, rate = 48000, streams = 0;
+    bool quiet = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:b:r:n:q")) != -1) {
+        switch (opt) {
+            case 's':
+                seconds = atof(optarg);
+                break;
+            case 'b':
+                block = atoi(optarg);
+                break;
+            case 'r':
+                rate = atoi(optarg);
+                break;
+            case 'n':
+                streams = atoi(optarg);
+                break;
+            case 'q':
+                quiet = true;
+                break;
+            default:
+                usage();
+        }
+    }
+    if (optind != argc || seconds <= 0 || !block || !rate) usage();
+
+    uint32_t frames = seconds * rate;
+    std::vector<float> inL(frames), inR(frames), outL(block), outR(block);
+    makeSignal(inL, inR, rate);
+    if (streams) return benchStreams(inL, inR, block, rate, streams);
+
+    BarrEngine engine;
+    engine.setSampleRate(rate);
+    if (!engine.activate()) {
+        fprintf(stderr, "bench: couldn't allocate DSP RAM\n");
+        return 1;
+    }
+    if (!quiet) printf("kernels %s, %u frame blocks at %uHz\n", engine.getKernels()->name, block, rate);
+
+    double total = 0;
+    for (uint32_t prog = 0; prog < 64; prog++) {
+        engine.setProgram(prog);
+        engine.reset();
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t done = 0; done < frames; done += block) {
+            uint32_t n = frames - done < block ? frames - done : block;
+            engine.run(&inL[done], &inR[done], outL.data(), outR.data(), n);
+        }
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        total += elapsed;
+        if (!quiet) printf("program %2u  %7.1fx realtime\n", prog + 1, seconds / elapsed);
+    }
+
+    printf("all programs %7.1fx realtime, %.3fs\n", 64 * seconds / total, total);
+    return 0;
+}
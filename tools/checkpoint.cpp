@@ -0,0 +1,135 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "checkpoint.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "snapshot.hpp"
+
+// "BARRCKP1", then the program, rate and ROM hash, the number of
+// checkpoints, and each checkpoint as its input and output hashes, frames,
+// state size and state, all little-endian
+
+static void put32(uint8_t *p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = v >> (8 * i);
+}
+
+static void put64(uint8_t *p, uint64_t v) {
+    for (int i = 0; i < 8; i++) p[i] = v >> (8 * i);
+}
+
+static uint32_t get32(const uint8_t *p) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++) v |= (uint32_t)p[i] << (8 * i);
+    return v;
+}
+
+static uint64_t get64(const uint8_t *p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) v |= (uint64_t)p[i] << (8 * i);
+    return v;
+}
+
+bool CheckpointIndex::load(const char *path) {
+    points.clear();
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+
+    uint8_t hdr[28];
+    bool ok = fread(hdr, 1, 28, f) == 28 && !memcmp(hdr, "BARRCKP1", 8);
+    if (ok) {
+        program = get32(hdr + 8);
+        rate = get32(hdr + 12);
+        rom_hash = get64(hdr + 16);
+    }
+
+    uint32_t count = ok ? get32(hdr + 24) : 0;
+    for (uint32_t i = 0; ok && i < count; i++) {
+        uint8_t rec[24];
+        ok = fread(rec, 1, 24, f) == 24;
+        if (!ok) break;
+
+        Checkpoint cp;
+        cp.input_hash = get64(rec);
+        cp.output_hash = get64(rec + 8);
+        cp.frames = get32(rec + 16);
+        uint32_t size = get32(rec + 20);
+        ok = cp.frames <= kInterval && size <= kSnapshotMaxBytes;
+        if (!ok) break;
+
+        cp.state.resize(size);
+        ok = fread(cp.state.data(), 1, size, f) == size;
+        points.push_back(cp);
+    }
+    fclose(f);
+
+    // the state after it all has to be there, on the end and nowhere else,
+    // or there's no telling where the render got to
+    for (size_t i = 0; ok && i < points.size(); i++) ok = (points[i].frames == 0) == (i + 1 == points.size());
+
+    if (!ok || points.empty()) points.clear();
+    return !points.empty();
+}
+
+bool CheckpointIndex::save(const char *path) const {
+    std::string tmp = std::string(path) + ".tmp";
+    FILE *f = fopen(tmp.c_str(), "wb");
+    if (!f) return false;
+
+    uint8_t hdr[28];
+    memcpy(hdr, "BARRCKP1", 8);
+    put32(hdr + 8, program);
+    put32(hdr + 12, rate);
+    put64(hdr + 16, rom_hash);
+    put32(hdr + 24, points.size());
+    bool ok = fwrite(hdr, 1, 28, f) == 28;
+
+    for (size_t i = 0; ok && i < points.size(); i++) {
+        uint8_t rec[24];
+        put64(rec, points[i].input_hash);
+        put64(rec + 8, points[i].output_hash);
+        put32(rec + 16, points[i].frames);
+        put32(rec + 20, points[i].state.size());
+        ok = fwrite(rec, 1, 24, f) == 24 &&
+             fwrite(points[i].state.data(), 1, points[i].state.size(), f) == points[i].state.size();
+    }
+    if (fclose(f) != 0) ok = false;
+
+    if (!ok || rename(tmp.c_str(), path) != 0) {
+        unlink(tmp.c_str());
+        return false;
+    }
+    return true;
+}
+
+uint64_t checkpointHash(const float *left, const float *right, uint32_t frames) {
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (uint32_t i = 0; i < frames; i++) {
+        uint32_t l, r;
+        memcpy(&l, &left[i], 4);
+        memcpy(&r, &right[i], 4);
+        h = (h ^ l) * 0x100000001b3ull;
+        h = (h ^ r) * 0x100000001b3ull;
+    }
+    return h;
+}
@@ -0,0 +1,59 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_CHECKPOINT_HPP
+#define BARRVERB_CHECKPOINT_HPP
+
+#include <stdint.h>
+
+#include <vector>
+
+// Engine checkpoints taken at regular points through a render, kept in a
+// file next to the output, so that rendering an edited version of the input
+// can skip the parts that haven't changed
+// Each one has the state at the start of a stretch of input and hashes of
+// that stretch and the output rendered from it, and there's one more on the
+// end with the state after it all
+// The output's hash is so that output which has since been replaced or
+// edited is never passed off as the render
+struct Checkpoint {
+    uint64_t input_hash;
+    uint64_t output_hash;
+    uint32_t frames;             // 0 for the one on the end
+    std::vector<uint8_t> state;  // an encoded EngineSnapshot
+};
+
+class CheckpointIndex {
+   public:
+    static const uint32_t kInterval = 65536;  // frames, about a second and a half
+
+    // what the checkpoints were taken from, they're no use for anything else
+    uint32_t program = 0;
+    uint32_t rate = 0;
+    uint64_t rom_hash = 0;
+
+    std::vector<Checkpoint> points;
+
+    bool load(const char *path);
+    bool save(const char *path) const;  // all or nothing
+};
+
+// FNV-1a over the samples' bits
+uint64_t checkpointHash(const float *left, const float *right, uint32_t frames);
+
+#endif  // BARRVERB_CHECKPOINT_HPP
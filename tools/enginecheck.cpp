@@ -0,0 +1,416 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+// Checks that the different ways of running the engine all give the same
+// output, sample for sample
+//
+// usage: enginecheck [-w file] [-c file]
+//
+//   -w file  writes every program's output to file, from a build with only
+//            the plain loop, for the other builds to be compared with
+//   -c file  compares the family kernels and the threaded interpreter with
+//            the plain loop's output from -w
+//
+// Every program is run over the same test signal, at a range of odd block
+// sizes, and compared against the planar float path:
+//   the integer PCM paths, stereo and with other channel counts
+//   EngineBatch, with some lanes given null inputs once the signal stops,
+//   against BarrEngines fed zeroes
+// and the float path itself is compared between the family kernels and the
+// threaded interpreter, and with the plain loop
+// "make check" builds it three times, with computed goto, with the switch
+// instead, and with only the plain loop to write out what the others are
+// compared with
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <vector>
+
+#include "batch.hpp"
+#include "engine.hpp"
+
+static const uint32_t kRate = 48000;
+static const uint32_t kFrames = kRate / 4;
+
+static const uint32_t sizes[] = {1, 3, 37, 64, 129, 255, 256, 257, 997};
+static const uint32_t kSizes = sizeof(sizes) / sizeof(sizes[0]);
+
+// Runs frames through f(offset, n) in blocks of every size in turn
+template <class F>
+static void inBlocks(uint32_t frames, F f) {
+    for (uint32_t done = 0, i = 0; done < frames; i++) {
+        uint32_t n = sizes[i % kSizes];
+        if (n > frames - done) n = frames - done;
+        f(done, n);
+        done += n;
+    }
+}
+
+static uint32_t seed = 1;
+
+static int32_t noise() {
+    seed = seed * 1664525 + 1013904223;
+    return (int32_t)seed;
+}
+
+// the output of one program as DAC words, left and right interleaved
+typedef std::vector<int16_t> Output;
+
+static bool report(bool ok, const char *what) {
+    printf("%s  %s\n", ok ? "ok  " : "FAIL", what);
+    return ok;
+}
+
+// the first program whose outputs differ, or -1
+static int compare(const std::vector<Output> &a, const std::vector<Output> &b) {
+    for (size_t prog = 0; prog < a.size(); prog++) {
+        if (a[prog] != b[prog]) return (int)prog;
+    }
+    return -1;
+}
+
+static bool reportCompare(const std::vector<Output> &a, const std::vector<Output> &b, const char *what) {
+    int prog = compare(a, b);
+    if (prog < 0) return report(true, what);
+
+    char msg[256];
+    snprintf(msg, sizeof(msg), "%s, program %d differs", what, prog + 1);
+    return report(false, msg);
+}
+
+static bool activate(BarrEngine &engine, uint32_t prog) {
+    engine.setSampleRate(kRate);
+    engine.setProgram(prog);
+    if (!engine.activate()) {
+        fprintf(stderr, "enginecheck: couldn't allocate DSP RAM\n");
+        return false;
+    }
+    return true;
+}
+
+// the reference, planar float through run()
+// the DAC words come out of the float path divided by 2048, exactly
+static bool runFloat(const std::vector<float> &inL, const std::vector<float> &inR, std::vector<Output> &out,
+                     bool families = true) {
+    out.assign(64, Output(2 * inL.size()));
+    std::vector<float> outL(inL.size()), outR(inL.size());
+
+    for (uint32_t prog = 0; prog < 64; prog++) {
+        BarrEngine engine;
+        if (!activate(engine, prog)) return false;
+        engine.setFamilies(families);
+        inBlocks(inL.size(), [&](uint32_t at, uint32_t n) {
+            engine.run(&inL[at], &inR[at], &outL[at], &outR[at], n);
+        });
+        for (size_t i = 0; i < inL.size(); i++) {
+            out[prog][2 * i] = (int16_t)(outL[i] * 2048);
+            out[prog][2 * i + 1] = (int16_t)(outR[i] * 2048);
+        }
+    }
+    return true;
+}
+
+// Integer PCM
+
+static inline int32_t read24(const uint8_t *p) {
+    return (int32_t)((uint32_t)p[0] << 8 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 24) >> 8;
+}
+
+static inline void write24(uint8_t *p, int32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+}
+
+// Interleaved samples of each width, converted to DAC words on the way out
+struct Pcm16 {
+    typedef int16_t Sample;
+    static const uint32_t kBytes = 2;
+    static void put(std::vector<Sample> &buf, size_t i, int32_t v) { buf[i] = v; }
+    static int32_t get(const std::vector<Sample> &buf, size_t i) { return buf[i]; }
+    static float toFloat(int32_t v) { return (float)v / 32768.0f; }
+    static int16_t toDac(int32_t v) { return v / 16; }
+    static void run(BarrEngine &e, const Sample *in, uint32_t ch, Sample *out, uint32_t n) { e.runInt16(in, ch, out, n); }
+};
+
+struct Pcm24 {
+    typedef uint8_t Sample;
+    static const uint32_t kBytes = 3;
+    static void put(std::vector<Sample> &buf, size_t i, int32_t v) { write24(&buf[3 * i], v); }
+    static int32_t get(const std::vector<Sample> &buf, size_t i) { return read24(&buf[3 * i]); }
+    static float toFloat(int32_t v) { return (float)v / 8388608.0f; }
+    static int16_t toDac(int32_t v) { return v / 4096; }
+    static void run(BarrEngine &e, const Sample *in, uint32_t ch, Sample *out, uint32_t n) { e.runInt24(in, ch, out, n); }
+};
+
+struct Pcm32 {
+    typedef int32_t Sample;
+    static const uint32_t kBytes = 4;
+    static void put(std::vector<Sample> &buf, size_t i, int32_t v) { buf[i] = v; }
+    static int32_t get(const std::vector<Sample> &buf, size_t i) { return buf[i]; }
+    static float toFloat(int32_t v) { return (float)v / 2147483648.0f; }
+    static int16_t toDac(int32_t v) { return v / 1048576; }
+    static void run(BarrEngine &e, const Sample *in, uint32_t ch, Sample *out, uint32_t n) { e.runInt32(in, ch, out, n); }
+};
+
+// every program through one of the integer paths
+template <class P>
+static bool runPcm(const std::vector<typename P::Sample> &in, uint32_t channels, std::vector<Output> &out) {
+    const uint32_t frames = in.size() / channels / (P::kBytes / sizeof(typename P::Sample));
+    const uint32_t step = P::kBytes / sizeof(typename P::Sample);
+    out.assign(64, Output(2 * frames));
+    std::vector<typename P::Sample> buf(2 * frames * step);
+
+    for (uint32_t prog = 0; prog < 64; prog++) {
+        BarrEngine engine;
+        if (!activate(engine, prog)) return false;
+        inBlocks(frames, [&](uint32_t at, uint32_t n) {
+            P::run(engine, &in[at * channels * step], channels, &buf[2 * at * step], n);
+        });
+        for (size_t i = 0; i < 2 * frames; i++) out[prog][i] = P::toDac(P::get(buf, i));
+    }
+    return true;
+}
+
+// Stereo at full resolution against the float path fed the same samples,
+// and then other channel counts against stereo
+// Those are weighted so that they add up to the same as the stereo pair,
+// from samples small enough that the sums are exact whatever the channel count
+template <class P>
+static bool checkPcm(const char *name, int shift) {
+    bool ok = true;
+    char what[128];
+
+    std::vector<typename P::Sample> stereo(2 * kFrames * P::kBytes / sizeof(typename P::Sample));
+    std::vector<float> inL(kFrames), inR(kFrames);
+    seed = 1;
+    for (uint32_t i = 0; i < kFrames; i++) {
+        // a quarter of a second of noise, and the rest silent to let it ring
+        int32_t l = i < kFrames / 4 ? noise() >> shift : 0;
+        int32_t r = i < kFrames / 4 ? noise() >> shift : 0;
+        P::put(stereo, 2 * i, l);
+        P::put(stereo, 2 * i + 1, r);
+        inL[i] = P::toFloat(l);
+        inR[i] = P::toFloat(r);
+    }
+
+    std::vector<Output> ref, out;
+    if (!runFloat(inL, inR, ref) || !runPcm<P>(stereo, 2, out)) return false;
+    snprintf(what, sizeof(what), "%s stereo against float", name);
+    ok &= reportCompare(ref, out, what);
+
+    // each weighting adds up to the channel count
+    static const int32_t w1[] = {1}, w4[] = {2, -1, 1, 2}, w8[] = {3, -1, 1, 1, 0, 2, 1, 1};
+    static const struct {
+        uint32_t channels;
+        const int32_t *weights;
+    } layouts[] = {{1, w1}, {4, w4}, {8, w8}};
+
+    std::vector<int32_t> mono(kFrames);
+    seed = 2;
+    for (uint32_t i = 0; i < kFrames; i++) mono[i] = i < kFrames / 4 ? (noise() >> 18) * (1 << (16 - shift)) : 0;
+
+    for (uint32_t i = 0; i < kFrames; i++) {
+        P::put(stereo, 2 * i, mono[i]);
+        P::put(stereo, 2 * i + 1, mono[i]);
+    }
+    if (!runPcm<P>(stereo, 2, ref)) return false;
+
+    for (const auto &layout : layouts) {
+        std::vector<typename P::Sample> in(layout.channels * kFrames * P::kBytes / sizeof(typename P::Sample));
+        for (uint32_t i = 0; i < kFrames; i++) {
+            for (uint32_t c = 0; c < layout.channels; c++) {
+                P::put(in, i * layout.channels + c, mono[i] * layout.weights[c]);
+            }
+        }
+        if (!runPcm<P>(in, layout.channels, out)) return false;
+        snprintf(what, sizeof(what), "%s %u-channel against stereo", name, layout.channels);
+        ok &= reportCompare(ref, out, what);
+    }
+
+    // and none at all is silence
+    BarrEngine engine;
+    if (!activate(engine, 0)) return false;
+    std::vector<typename P::Sample> buf(2 * kFrames * P::kBytes / sizeof(typename P::Sample), 1);
+    P::run(engine, stereo.data(), 0, buf.data(), kFrames);
+    bool silent = true;
+    for (size_t i = 0; i < 2 * kFrames; i++) silent &= P::get(buf, i) == 0;
+    snprintf(what, sizeof(what), "%s with no channels is silent", name);
+    ok &= report(silent, what);
+
+    return ok;
+}
+
+// EngineBatch
+
+static bool checkBatch() {
+    const uint32_t kLanes = EngineBatch::kLanes;
+    std::vector<float> in[kLanes];
+    std::vector<float> batch_out[kLanes][2], engine_out[kLanes][2];
+    seed = 3;
+    for (uint32_t l = 0; l < kLanes; l++) {
+        in[l].resize(kFrames);
+        for (uint32_t i = 0; i < kFrames / 4; i++) in[l][i] = noise() / 4294967296.0f;
+        for (uint32_t c = 0; c < 2; c++) {
+            batch_out[l][c].resize(kFrames);
+            engine_out[l][c].resize(kFrames);
+        }
+    }
+
+    for (uint32_t prog = 0; prog < 64; prog++) {
+        EngineBatch batch;
+        BarrEngine engines[kLanes];
+        batch.setSampleRate(kRate);
+        batch.setProgram(prog);
+        if (!batch.activate()) {
+            fprintf(stderr, "enginecheck: couldn't allocate DSP RAM\n");
+            return false;
+        }
+        for (uint32_t l = 0; l < kLanes; l++) {
+            if (!activate(engines[l], prog)) return false;
+        }
+
+        inBlocks(kFrames, [&](uint32_t at, uint32_t n) {
+            const float *inL[kLanes], *inR[kLanes];
+            float *outL[kLanes], *outR[kLanes];
+            for (uint32_t l = 0; l < kLanes; l++) {
+                // every other lane has no input at all once it's silent
+                bool none = (l & 1) && at >= kFrames / 4;
+                inL[l] = inR[l] = none ? nullptr : &in[l][at];
+                outL[l] = &batch_out[l][0][at];
+                outR[l] = &batch_out[l][1][at];
+                engines[l].run(&in[l][at], &in[l][at], &engine_out[l][0][at], &engine_out[l][1][at], n);
+            }
+            batch.run(inL, inR, outL, outR, kLanes, n);
+        });
+
+        for (uint32_t l = 0; l < kLanes; l++) {
+            if (batch_out[l][0] != engine_out[l][0] || batch_out[l][1] != engine_out[l][1]) {
+                char what[128];
+                snprintf(what, sizeof(what), "batch against engines, program %u lane %u differs", prog + 1, l);
+                return report(false, what);
+            }
+        }
+    }
+    return report(true, "batch against engines");
+}
+
+// The interpreters
+
+static bool writeOutputs(const char *path, const std::vector<Output> &out) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+
+    bool ok = true;
+    for (const Output &o : out) ok &= fwrite(o.data(), sizeof(int16_t), o.size(), f) == o.size();
+    return fclose(f) == 0 && ok;
+}
+
+static bool readOutputs(const char *path, std::vector<Output> &out) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+
+    bool ok = true;
+    out.assign(64, Output(2 * kFrames));
+    for (Output &o : out) ok &= fread(o.data(), sizeof(int16_t), o.size(), f) == o.size();
+    ok &= fgetc(f) == EOF;
+    fclose(f);
+    return ok;
+}
+
+// Every program through the family kernels where it fits one, and through
+// the threaded interpreter, against each other and against the plain loop
+static bool checkInterpreters(const char *write_path, const char *compare_path) {
+    bool ok = true;
+
+    std::vector<float> inL(kFrames), inR(kFrames);
+    seed = 4;
+    for (uint32_t i = 0; i < kFrames / 4; i++) {
+        inL[i] = noise() / 4294967296.0f;
+        inR[i] = noise() / 4294967296.0f;
+    }
+
+    std::vector<Output> families, threaded;
+    if (!runFloat(inL, inR, families) || !runFloat(inL, inR, threaded, false)) return false;
+
+    // a plain build has neither, it runs everything on the plain loop
+    uint32_t fits = 0;
+    for (uint32_t prog = 0; prog < 64; prog++) {
+        BarrEngine engine;
+        if (!activate(engine, prog)) return false;
+        fits += engine.runsFamily();
+    }
+    if (fits) ok &= reportCompare(threaded, families, "family kernels against the threaded interpreter");
+
+    if (write_path && !writeOutputs(write_path, families)) {
+        fprintf(stderr, "enginecheck: couldn't write %s\n", write_path);
+        return false;
+    }
+    if (compare_path) {
+        std::vector<Output> plain;
+        if (!readOutputs(compare_path, plain)) {
+            fprintf(stderr, "enginecheck: couldn't read %s\n", compare_path);
+            return false;
+        }
+        ok &= reportCompare(plain, families, "family kernels against the plain loop");
+        ok &= reportCompare(plain, threaded, "threaded interpreter against the plain loop");
+    }
+    return ok;
+}
+
+static void usage() {
+    fprintf(stderr, "usage: enginecheck [-w file] [-c file]\n");
+    exit(1);
+}
+
+int main(int argc, char **argv) {
+    const char *write_path = nullptr, *compare_path = nullptr;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "w:c:")) != -1) {
+        switch (opt) {
+            case 'w':
+                write_path = optarg;
+                break;
+            case 'c':
+                compare_path = optarg;
+                break;
+            default:
+                usage();
+        }
+    }
+    if (optind != argc) usage();
+
+    bool ok = true;
+
+    ok &= checkInterpreters(write_path, compare_path);
+    ok &= checkPcm<Pcm16>("int16", 16);
+    ok &= checkPcm<Pcm24>("int24", 8);
+    ok &= checkPcm<Pcm32>("int32", 0);
+    ok &= checkBatch();
+
+    if (!ok) {
+        printf("the engine's paths don't agree\n");
+        return 1;
+    }
+    printf("the engine's paths all agree\n");
+    return 0;
+}
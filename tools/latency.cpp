@@ -0,0 +1,274 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+// Measures how long each call to run() takes when it's called the way hosts
+// call it, and reports the spread, because it's the slowest block rather than
+// the average that causes a dropout
+//
+// usage: latency [-n instances] [-c callbacks] [-r rate] [-m megabytes] [-t ms]
+//
+//   -n instances  of the plugin, all run in turn on the one thread, 16 by default
+//   -c callbacks  from the host for each pattern, 1000 by default
+//   -r rate       sample rate, 48000 by default
+//   -m megabytes  of memory the neighbours scribble over, 8 by default, 0 for none
+//   -t ms         runs the engines on threads of their own this far behind, see
+//                 the Thread Latency parameter, 0 by default for none
+//
+// Each pattern is run once on its own and once with neighbours, standing in
+// for other plugins in the same callback, that evict the caches before every
+// call, which is closer to a busy session
+// The meter columns are the plugins' own timings of the engine, drained from
+// their LoadMeters on another thread as a monitor would, so the gap between
+// those and the host's times is the cost of the way in and out, and with -t
+// they're the engine threads' blocks rather than the host's
+// For steady numbers, run it with realtime priority, with "chrt -f 80" say
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// the parts of DPF that every plugin format is built on, as DistrhoPluginMain.cpp has them
+#include "src/DistrhoPlugin.cpp"
+#include "src/DistrhoUtils.cpp"
+
+#include "barrverb.hpp"
+
+USE_NAMESPACE_DISTRHO
+
+static const uint32_t kMaxBlock = 2048;
+static float in_buf[2][kMaxBlock], out_buf[2][kMaxBlock];
+static const float *inputs[2] = {in_buf[0], in_buf[1]};
+static float *outputs[2] = {out_buf[0], out_buf[1]};
+
+static uint32_t seed = 1;
+
+static uint32_t nextRandom(uint32_t range) {
+    seed = seed * 1664525 + 1013904223;
+    return (seed >> 8) % range;
+}
+
+static void usage() {
+    fprintf(stderr, "usage: latency [-n instances] [-c callbacks] [-r rate] [-m megabytes] [-t ms]\n");
+    exit(1);
+}
+
+// The ways hosts hand out blocks
+enum Pattern {
+    patternFixed,     // the same power of two every time
+    patternSplit,     // a fixed block cut at automation points, with a program change at each cut
+    patternVariable,  // anything from one frame up, as some hosts do around loops and tempo changes
+    kPatternCount
+};
+
+static const char *const pattern_names[kPatternCount] = {
+    "fixed 256 frames",
+    "256 split by automation",
+    "variable 1 to 2048 frames",
+};
+
+// the pieces of one host callback, and the program to change to before each
+// one, or -1 for none
+static uint32_t callback(Pattern pattern, uint32_t *frames, int *program) {
+    switch (pattern) {
+        case patternFixed:
+            frames[0] = 256;
+            program[0] = -1;
+            return 1;
+
+        case patternSplit: {
+            // up to three cuts, anywhere, so most of the pieces are odd lengths
+            uint32_t cuts[4], n = 1 + nextRandom(3);
+            for (uint32_t i = 0; i < n; i++) cuts[i] = 1 + nextRandom(255);
+            std::sort(cuts, cuts + n);
+            uint32_t start = 0, pieces = 0;
+            for (uint32_t i = 0; i <= n; i++) {
+                uint32_t end = i < n ? cuts[i] : 256;
+                if (end == start) continue;
+                frames[pieces] = end - start;
+                program[pieces] = pieces ? (int)nextRandom(64) : -1;
+                pieces++;
+                start = end;
+            }
+            return pieces;
+        }
+
+        default:
+            frames[0] = 1 + nextRandom(kMaxBlock);
+            program[0] = -1;
+            return 1;
+    }
+}
+
+// other plugins' worth of memory traffic, a write to every cache line
+static void neighbours(std::vector<uint8_t> &memory) {
+    static uint8_t value = 0;
+    value++;
+    for (size_t i = 0; i < memory.size(); i += 64) memory[i] = value;
+}
+
+static double percentile(const std::vector<float> &sorted, double p) {
+    if (sorted.empty()) return 0;
+    size_t i = p * sorted.size();
+    return sorted[i < sorted.size() ? i : sorted.size() - 1];
+}
+
+// Empties every plugin's stats feed until told to stop, keeping the blocks
+// that started once timing had begun
+// The feeds only hold so many blocks, and anything that doesn't fit is
+// dropped, so it polls them often
+static void drainMeters(const std::vector<LoadMeter *> &meters, const std::atomic<uint64_t> &from_ns,
+                        const std::atomic<bool> &stop, std::vector<float> &times) {
+    for (LoadMeter *meter : meters) meter->attachReader();
+    for (;;) {
+        bool finished = stop.load();
+        uint32_t drained = 0;
+        for (LoadMeter *meter : meters) {
+            BlockTiming t;
+            while (meter->pop(t)) {
+                drained++;
+                uint64_t from = from_ns.load(std::memory_order_relaxed);
+                if (from && t.start_ns >= from) times.push_back(t.elapsed_ns / 1e3f);
+            }
+        }
+        // one more pass after being told, for whatever was left
+        if (finished) break;
+        if (!drained) std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    for (LoadMeter *meter : meters) meter->detachReader();
+}
+
+int main(int argc, char **argv) {
+    uint32_t instances = 16, callbacks = 1000, rate = 48000, megabytes = 8, thread_ms = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:c:r:m:t:")) != -1) {
+        switch (opt) {
+            case 'n':
+                instances = atoi(optarg);
+                break;
+            case 'c':
+                callbacks = atoi(optarg);
+                break;
+            case 'r':
+                rate = atoi(optarg);
+                break;
+            case 'm':
+                megabytes = atoi(optarg);
+                break;
+            case 't':
+                thread_ms = atoi(optarg);
+                break;
+            default:
+                usage();
+        }
+    }
+    if (optind != argc || !instances || !callbacks || !rate) usage();
+
+    // a quiet noise floor, so the reverbs always have something to chew on
+    for (uint32_t i = 0; i < kMaxBlock; i++) {
+        in_buf[0][i] = (nextRandom(2001) - 1000.0f) / 10000;
+        in_buf[1][i] = (nextRandom(2001) - 1000.0f) / 10000;
+    }
+
+    d_nextBufferSize = kMaxBlock;
+    d_nextSampleRate = rate;
+    std::vector<PluginExporter *> plugins(instances);
+    std::vector<LoadMeter *> meters(instances);
+    for (uint32_t i = 0; i < instances; i++) {
+        plugins[i] = new PluginExporter(nullptr, nullptr, nullptr, nullptr);
+        meters[i] = &((BarrVerb *)plugins[i]->getInstancePointer())->getLoadMeter();
+        plugins[i]->setParameterValue(BarrVerb::paramProgram, i % 64 + 1);
+        plugins[i]->setParameterValue(BarrVerb::paramThreadLatency, thread_ms);
+        plugins[i]->activate();
+    }
+
+    std::vector<uint8_t> memory((size_t)megabytes << 20);
+    std::vector<float> times, meter_times;
+    times.reserve((size_t)callbacks * instances * 4);
+
+    printf("%u instances at %uHz, %u callbacks for each pattern\n", instances, rate, callbacks);
+    if (thread_ms) printf("engines on their own threads, %ums behind\n", thread_ms);
+    printf("%-28s %-10s %9s %9s %9s %9s %9s %9s %9s\n", "pattern", "neighbours", "p50 us", "p99 us", "p99.9 us",
+           "max us", "max load", "meter p99", "meter max");
+
+    for (uint32_t pass = 0; pass < kPatternCount * 2; pass++) {
+        Pattern pattern = (Pattern)(pass / 2);
+        bool thrash = pass & 1;
+        if (thrash && memory.empty()) continue;
+
+        times.clear();
+        meter_times.clear();
+        double worst_load = 0;
+        seed = 1;
+
+        std::atomic<uint64_t> from_ns{0};
+        std::atomic<bool> stop{false};
+        std::thread drainer(drainMeters, std::cref(meters), std::cref(from_ns), std::cref(stop),
+                            std::ref(meter_times));
+
+        // a few callbacks to settle before anything is timed
+        for (uint32_t cb = 0; cb < callbacks + 16; cb++) {
+            if (cb == 16) {
+                from_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now().time_since_epoch())
+                                  .count());
+            }
+            for (uint32_t i = 0; i < instances; i++) {
+                uint32_t frames[4];
+                int program[4];
+                uint32_t pieces = callback(pattern, frames, program);
+
+                for (uint32_t k = 0; k < pieces; k++) {
+                    if (program[k] >= 0) plugins[i]->setParameterValue(BarrVerb::paramProgram, program[k] + 1);
+                    if (thrash) neighbours(memory);
+
+                    auto start = std::chrono::steady_clock::now();
+                    plugins[i]->run(inputs, outputs, frames[k]);
+                    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+                    if (cb < 16) continue;
+                    times.push_back(elapsed * 1e6);
+                    // how much of the time the piece covers it took to run
+                    double load = elapsed * rate / frames[k];
+                    if (load > worst_load) worst_load = load;
+                }
+            }
+        }
+
+        stop.store(true);
+        drainer.join();
+
+        std::sort(times.begin(), times.end());
+        std::sort(meter_times.begin(), meter_times.end());
+        printf("%-28s %-10s %9.1f %9.1f %9.1f %9.1f %8.1f%% %9.1f %9.1f\n", pattern_names[pattern],
+               thrash ? "yes" : "no", percentile(times, 0.5), percentile(times, 0.99), percentile(times, 0.999),
+               times.back(), worst_load * 100, percentile(meter_times, 0.99), percentile(meter_times, 1));
+    }
+
+    for (uint32_t i = 0; i < instances; i++) {
+        plugins[i]->deactivate();
+        delete plugins[i];
+    }
+    return 0;
+}
@@ -0,0 +1,175 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+// Shows what every BarrVerb instance publishing telemetry is doing, see
+// plugin/telemetry.hpp
+//
+// usage: monitor [-i ms] [-1] [-h] [segment]
+//
+//   -i ms    how often to refresh, 1000 by default
+//   -1       print it once and exit, for scripts
+//   -h       shows how the block times are spread instead, as the percentage
+//            of blocks in each of LoadMeter's bins, labelled with where the
+//            bin starts as a percentage of the time available
+//   segment  the shared-memory segment, $BARRVERB_TELEMETRY or "/barrverb"
+//            by default, which is what the plugins have to be started with
+//
+// Records whose process has gone are left out, and the plugins reuse them
+
+#include <errno.h>
+#include <math.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <thread>
+
+#include "rom.h"
+#include "telemetry.hpp"
+
+static void usage() {
+    fprintf(stderr, "usage: monitor [-i ms] [-1] [-h] [segment]\n");
+    exit(1);
+}
+
+static void dbfs(char *out, size_t size, float level) {
+    if (level <= 0) {
+        snprintf(out, size, "-inf");
+    } else {
+        snprintf(out, size, "%.1f", 20 * log10f(level));
+    }
+}
+
+// a record that's in use by a process that's still there
+static bool live(const TelemetryRecord &rec, TelemetryValues &v) {
+    if (!rec.owner.load(std::memory_order_relaxed)) return false;
+    if (!telemetryRead(rec, v) || !v.owner) return false;
+    return kill(v.owner, 0) == 0 || errno != ESRCH;
+}
+
+static void showHistogram(const TelemetrySegment *segment) {
+    printf("%7s %4s", "pid", "inst");
+    for (uint32_t b = 0; b < LoadMeter::kBins; b++) printf(" %4u%%", b * 10);
+    printf("+\n");
+
+    uint32_t shown = 0;
+    for (uint32_t i = 0; i < kTelemetrySlots; i++) {
+        TelemetryValues v;
+        if (!live(segment->records[i], v)) continue;
+
+        uint64_t blocks = 0;
+        for (uint32_t b = 0; b < LoadMeter::kBins; b++) blocks += v.histogram[b];
+        printf("%7u %4u", v.owner, v.instance);
+        for (uint32_t b = 0; b < LoadMeter::kBins; b++) {
+            if (v.histogram[b]) {
+                printf(" %5.1f", 100.0 * v.histogram[b] / blocks);
+            } else {
+                printf(" %5s", "-");
+            }
+        }
+        printf("\n");
+        shown++;
+    }
+    printf("%u instances\n", shown);
+}
+
+static void show(const TelemetrySegment *segment) {
+    uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch())
+                       .count();
+
+    printf("%7s %4s %-28s %6s %6s %7s %7s %10s %6s %s\n", "pid", "inst", "program", "load%", "peak%", "L dBFS",
+           "R dBFS", "full scale", "age s", "");
+    uint32_t shown = 0;
+    for (uint32_t i = 0; i < kTelemetrySlots; i++) {
+        TelemetryValues v;
+        if (!live(segment->records[i], v)) continue;
+
+        char name[40], l[16], r[16], age[16];
+        if (v.program >= 1 && v.program <= 64) {
+            snprintf(name, sizeof(name), "%2u %.25s", v.program, prog_name[v.program - 1]);
+        } else {
+            snprintf(name, sizeof(name), "-");
+        }
+        dbfs(l, sizeof(l), v.level_l);
+        dbfs(r, sizeof(r), v.level_r);
+        if (v.updated_ns) {
+            // it may have been updated since now was read
+            snprintf(age, sizeof(age), "%.1f", v.updated_ns < now ? (now - v.updated_ns) / 1e9 : 0.0);
+        } else {
+            snprintf(age, sizeof(age), "never");
+        }
+
+        printf("%7u %4u %-28s %6.1f %6.1f %7s %7s %10llu %6s %s\n", v.owner, v.instance, name, v.load * 100,
+               v.peak_load * 100, l, r, (unsigned long long)v.full_scale, age, v.asleep ? "asleep" : "");
+        shown++;
+    }
+    printf("%u instances\n", shown);
+}
+
+int main(int argc, char **argv) {
+    uint32_t interval = 1000;
+    bool once = false, histogram = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "i:1h")) != -1) {
+        switch (opt) {
+            case 'i':
+                interval = atoi(optarg);
+                break;
+            case '1':
+                once = true;
+                break;
+            case 'h':
+                histogram = true;
+                break;
+            default:
+                usage();
+        }
+    }
+    if (argc - optind > 1 || !interval) usage();
+
+    const char *name = getenv("BARRVERB_TELEMETRY");
+    if (optind < argc) name = argv[optind];
+    if (!name || !name[0]) name = "/barrverb";
+
+    TelemetrySegment *segment = telemetryMap(name, false);
+    if (!segment) {
+        fprintf(stderr, "monitor: can't open %s, has a plugin been started with BARRVERB_TELEMETRY=%s?\n", name,
+                name);
+        return 1;
+    }
+
+    for (;;) {
+        // clear the screen and start from the top
+        if (!once) printf("\033[H\033[2J");
+        if (histogram) {
+            showHistogram(segment);
+        } else {
+            show(segment);
+        }
+        fflush(stdout);
+        if (once) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(interval));
+    }
+
+    telemetryUnmap(segment);
+    return 0;
+}
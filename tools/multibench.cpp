@@ -0,0 +1,129 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+// Runs BarrVerb Multi the way a host does over every program, with and
+// without its worker threads, and reports how much faster than realtime it
+// goes
+// This is the training workload for the multichannel plugin in the
+// profile-guided release build
+//
+// usage: multibench [-s seconds] [-b block] [-r rate] [-q]
+//
+//   -s seconds  of audio for each program, 2 by default
+//   -b block    frames per call to run(), 256 by default
+//   -r rate     sample rate, 48000 by default
+//   -q          only print the totals
+//
+// It's built for the same number of channels as the plugin, "make CHANNELS=64"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <vector>
+
+// the parts of DPF that every plugin format is built on, as DistrhoPluginMain.cpp has them
+#include "src/DistrhoPlugin.cpp"
+#include "src/DistrhoUtils.cpp"
+
+#include "barrverbmulti.hpp"
+
+USE_NAMESPACE_DISTRHO
+
+static void usage() {
+    fprintf(stderr, "usage: multibench [-s seconds] [-b block] [-r rate] [-q]\n");
+    exit(1);
+}
+
+int main(int argc, char **argv) {
+    double seconds = 2;
+    uint32_t block = 256, rate = 48000;
+    bool quiet = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:b:r:q")) != -1) {
+        switch (opt) {
+            case 's':
+                seconds = atof(optarg);
+                break;
+            case 'b':
+                block = atoi(optarg);
+                break;
+            case 'r':
+                rate = atoi(optarg);
+                break;
+            case 'q':
+                quiet = true;
+                break;
+            default:
+                usage();
+        }
+    }
+    if (optind != argc || seconds <= 0 || !block || !rate) usage();
+
+    // bursts of noise in every channel, with each pair going quiet in turn
+    // so that some batches go to sleep and wake up again
+    const uint32_t kChannels = BarrVerbMulti::kChannels;
+    const uint32_t frames = seconds * rate;
+    std::vector<std::vector<float>> in(kChannels, std::vector<float>(frames));
+    std::vector<std::vector<float>> out(kChannels, std::vector<float>(block));
+    uint32_t seed = 1;
+    for (uint32_t c = 0; c < kChannels; c++) {
+        for (uint32_t i = 0; i < frames; i++) {
+            seed = seed * 1664525 + 1013904223;
+            bool on = (i / (rate / 4) + c / 2) % 4 != 0;
+            in[c][i] = on ? (int32_t)seed / 4294967296.0f : 0.0f;
+        }
+    }
+
+    d_nextBufferSize = block;
+    d_nextSampleRate = rate;
+    PluginExporter plugin(nullptr, nullptr, nullptr, nullptr);
+    printf("%u channels, %u frame blocks at %uHz\n", kChannels, block, rate);
+
+    for (uint32_t threads = 0; threads < 2; threads++) {
+        plugin.setParameterValue(BarrVerbMulti::paramThreads, threads);
+        plugin.activate();
+
+        double total = 0;
+        for (uint32_t prog = 0; prog < 64; prog++) {
+            plugin.setParameterValue(BarrVerbMulti::paramProgram, prog + 1);
+
+            std::vector<const float *> inputs(kChannels);
+            std::vector<float *> outputs(kChannels);
+            for (uint32_t c = 0; c < kChannels; c++) outputs[c] = out[c].data();
+
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t done = 0; done < frames; done += block) {
+                uint32_t n = frames - done < block ? frames - done : block;
+                for (uint32_t c = 0; c < kChannels; c++) inputs[c] = &in[c][done];
+                plugin.run(inputs.data(), outputs.data(), n);
+            }
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            total += elapsed;
+            if (!quiet) printf("program %2u  %7.1fx realtime\n", prog + 1, seconds / elapsed);
+        }
+
+        plugin.deactivate();
+        printf("all programs %s %7.1fx realtime, %.3fs\n", threads ? "with worker threads" : "on one thread",
+               64 * seconds / total, total);
+    }
+    return 0;
+}
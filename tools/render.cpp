@@ -0,0 +1,506 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+// Renders a WAV file through BarrVerb
+//
+// usage: render [-p program] [-r rom] [-a] [-j threads] [-c cache] [-s megabytes] [-k] in.wav out.wav
+//
+//   -p program  1 to 64, the same numbering as the plugin, 20 by default
+//   -r rom      a ROM image to use instead of the built-in one
+//   -a          audition every program at once, writing out-01.wav to
+//               out-64.wav alongside out.wav's name
+//   -j threads  threads to audition with, one per core by default
+//   -c cache    a directory to keep renders in, see rendercache.hpp, so that
+//               rendering the same input the same way again is just a copy
+//   -s megabytes  the most the cache may hold, 4096 by default
+//   -k          keeps checkpoints of the engine in out.wav.ckpt, and uses the
+//               ones from last time to render only what has changed in the
+//               input, see renderIncremental()
+//
+// The input is summed to mono as in the plugin, and the output is 16-bit stereo
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "audition.hpp"
+#include "checkpoint.hpp"
+#include "denormals.hpp"
+#include "engine.hpp"
+#include "rendercache.hpp"
+#include "ringbuffer.hpp"
+#include "romimage.hpp"
+#include "rtpool.hpp"
+#include "snapshot.hpp"
+#include "wavfile.hpp"
+
+static const uint32_t kChunk = 8192;
+
+static void usage() {
+    fprintf(stderr,
+            "usage: render [-p program] [-r rom] [-a] [-j threads] [-c cache] [-s megabytes] [-k] in.wav out.wav\n");
+    exit(1);
+}
+
+// Rendering a single program is a pipeline, with a thread for each stage
+// and blocks passed along lock-free queues, so reading and writing the files
+// and the input filters all happen alongside the engine rather than in turn
+//
+//   decode -> filter -> engine -> encode
+//      ^                            |
+//      +--------- free blocks ------+
+//
+// A block with no frames in it marks the end of the file
+// Once a block has been passed on it can come straight back round, so each
+// stage has to take everything it needs from it first
+
+static const uint32_t kBlocks = 8;
+
+struct Block {
+    float inL[kChunk], inR[kChunk];
+    float mono[kChunk];  // summed and filtered
+    float outL[kChunk], outR[kChunk];
+    uint32_t frames;
+};
+
+// a queue that the consumer can sleep on
+// there are never more than kBlocks in flight, so put() never finds it full
+class Pipe {
+   public:
+    void put(Block *b) {
+        queue.push(b);
+        ready.post();
+    }
+
+    Block *get() {
+        Block *b = nullptr;
+        ready.wait();
+        queue.pop(b);
+        return b;
+    }
+
+   private:
+    RingBuffer<Block *, kBlocks> queue;
+    Semaphore ready;
+};
+
+struct Pipeline {
+    WavReader *in;
+    WavWriter out;
+    BarrEngine engine;
+    Cascade filter;
+    const Kernels *kern;
+
+    Pipe free, decoded, filtered, rendered;
+    std::atomic<bool> failed{false};
+};
+
+static void decodeStage(Pipeline *pl) {
+    for (;;) {
+        Block *b = pl->free.get();
+        uint32_t frames = pl->failed ? 0 : pl->in->read(b->inL, b->inR, kChunk);
+        b->frames = frames;
+        pl->decoded.put(b);
+        if (!frames) return;
+    }
+}
+
+static void filterStage(Pipeline *pl) {
+    ScopedDenormals ftz;
+    for (;;) {
+        Block *b = pl->decoded.get();
+        uint32_t frames = b->frames;
+        pl->kern->mixFloat(b->inL, b->inR, b->mono, frames);
+        pl->kern->cascade(pl->filter, b->mono, frames);
+        pl->filtered.put(b);
+        if (!frames) return;
+    }
+}
+
+static void encodeStage(Pipeline *pl) {
+    for (;;) {
+        Block *b = pl->rendered.get();
+        uint32_t frames = b->frames;
+        // after an error, keep passing blocks round until the end comes through
+        if (frames && !pl->failed && !pl->out.write(b->outL, b->outR, frames)) pl->failed = true;
+        pl->free.put(b);
+        if (!frames) return;
+    }
+}
+
+static int renderOne(WavReader &in, const char *out_path, const RomImage *rom, uint32_t program) {
+    Pipeline *pl = new Pipeline;
+    pl->in = &in;
+    if (!pl->out.open(out_path, in.getRate())) {
+        fprintf(stderr, "render: can't write %s\n", out_path);
+        delete pl;
+        return 1;
+    }
+
+    // the filters are run ahead of the engine, as AuditionBank does
+    pl->kern = kernelsSelect();
+    memset(&pl->filter, 0, sizeof(pl->filter));
+    cascadeDesign(pl->filter, in.getRate());
+
+    BarrEngine &engine = pl->engine;
+    engine.setSampleRate(in.getRate());
+    engine.setRom(rom);
+    engine.setProgram(program - 1);
+    if (!engine.activate()) {
+        fprintf(stderr, "render: couldn't allocate DSP RAM\n");
+        delete pl;
+        return 1;
+    }
+
+    std::vector<Block> blocks(kBlocks);
+    for (uint32_t i = 0; i < kBlocks; i++) pl->free.put(&blocks[i]);
+
+    std::thread decoder(decodeStage, pl), filterer(filterStage, pl), encoder(encodeStage, pl);
+
+    // the engine runs here
+    for (;;) {
+        Block *b = pl->filtered.get();
+        uint32_t frames = b->frames;
+        engine.runPrefiltered(b->mono, b->outL, b->outR, frames);
+        pl->rendered.put(b);
+        if (!frames) break;
+    }
+
+    decoder.join();
+    filterer.join();
+    encoder.join();
+
+    int ret = 0;
+    if (!pl->out.close() || pl->failed) {
+        fprintf(stderr, "render: error writing %s\n", out_path);
+        ret = 1;
+    }
+    delete pl;
+    return ret;
+}
+
+// Re-rendering an edited input
+// The input is taken a checkpoint interval at a time, and while it matches
+// what was rendered last time, and the engine would be in the same state, the
+// old output is copied rather than rendered again
+// At the first change the engine is put back to the checkpoint before it and
+// rendered from there, until its state comes back round to a checkpoint from
+// last time with the input the same from there on, which for most programs
+// is soon after the edit has died away
+// The output and checkpoints are written alongside and swapped in at the end
+
+static uint32_t readFull(WavReader &in, float *left, float *right, uint32_t frames) {
+    uint32_t got = 0, n;
+    while (got < frames && (n = in.read(left + got, right + got, frames - got)) > 0) got += n;
+    return got;
+}
+
+// render's input filters are run ahead of the engine, so their state goes in
+// the snapshot in place of the engine's own
+static void saveState(const BarrEngine &engine, const Cascade &filter, EngineSnapshot &snap, std::vector<uint8_t> &out) {
+    engine.capture(snap);
+    memcpy(snap.filter, filter.s, sizeof(snap.filter));
+    memcpy(snap.filter_in, filter.u, sizeof(snap.filter_in));
+    snap.filter_fill = filter.fill;
+
+    out.resize(kSnapshotMaxBytes);
+    out.resize(snapshotEncode(snap, out.data()));
+}
+
+static bool loadState(BarrEngine &engine, Cascade &filter, EngineSnapshot &snap, const std::vector<uint8_t> &in) {
+    if (!snapshotDecode(in.data(), in.size(), snap)) return false;
+    engine.apply(snap);
+    memcpy(filter.s, snap.filter, sizeof(filter.s));
+    memcpy(filter.u, snap.filter_in, sizeof(filter.u));
+    filter.fill = snap.filter_fill;
+    return true;
+}
+
+static int renderIncremental(WavReader &in, const char *out_path, const RomImage *rom, uint32_t program) {
+    const uint32_t I = CheckpointIndex::kInterval;
+    std::string ckpt_path = std::string(out_path) + ".ckpt", tmp_path = std::string(out_path) + ".tmp";
+
+    // last time's checkpoints, if they were for the same program, ROM and rate
+    CheckpointIndex old;
+    WavReader old_out;
+    bool have_old = old.load(ckpt_path.c_str()) && old.program == program && old.rom_hash == rom->hash &&
+                    old.rate == in.getRate() && old_out.open(out_path) && old_out.getRate() == in.getRate();
+
+    WavWriter out;
+    if (!out.open(tmp_path.c_str(), in.getRate())) {
+        fprintf(stderr, "render: can't write %s\n", tmp_path.c_str());
+        return 1;
+    }
+
+    const Kernels *kern = kernelsSelect();
+    Cascade filter;
+    memset(&filter, 0, sizeof(filter));
+    cascadeDesign(filter, in.getRate());
+
+    BarrEngine engine;
+    engine.setSampleRate(in.getRate());
+    engine.setRom(rom);
+    engine.setProgram(program - 1);
+    if (!engine.activate()) {
+        fprintf(stderr, "render: couldn't allocate DSP RAM\n");
+        return 1;
+    }
+
+    CheckpointIndex next;
+    next.program = program;
+    next.rate = in.getRate();
+    next.rom_hash = rom->hash;
+
+    std::vector<float> inL(I), inR(I), outL(I), outR(I), mono(kChunk);
+    EngineSnapshot *snap = new EngineSnapshot;
+    ScopedDenormals ftz;
+
+    // following is true while the engine ought to be in the same state as it
+    // was last time, without having been run to get there
+    bool following = have_old, ok = true;
+    uint32_t n, j = 0;
+    uint64_t rendered = 0, total = 0;
+    for (; ok && (n = readFull(in, inL.data(), inR.data(), I)) > 0; j++) {
+        Checkpoint cp;
+        cp.input_hash = checkpointHash(inL.data(), inR.data(), n);
+        cp.frames = n;
+
+        // the old output is read in step whether it's used or not
+        const Checkpoint *prev = have_old && j < old.points.size() ? &old.points[j] : nullptr;
+        uint32_t old_frames = have_old ? readFull(old_out, outL.data(), outR.data(), n) : 0;
+        bool same_input = prev && prev->input_hash == cp.input_hash && prev->frames == n && old_frames == n &&
+                          prev->output_hash == checkpointHash(outL.data(), outR.data(), n);
+
+        if (!following) saveState(engine, filter, *snap, cp.state);
+        if (same_input && (following || cp.state == prev->state)) {
+            // nothing has changed, the old output is already in outL and outR
+            following = true;
+            cp.state = prev->state;
+        } else {
+            // following can only run off the end of the checkpoints, or into
+            // one that won't decode, if the file is damaged
+            if (following && (!prev || !loadState(engine, filter, *snap, prev->state))) {
+                fprintf(stderr, "render: %s is damaged\n", ckpt_path.c_str());
+                ok = false;
+                break;
+            }
+            if (following) cp.state = prev->state;
+            following = false;
+
+            for (uint32_t i = 0; i < n; i += kChunk) {
+                uint32_t m = n - i < kChunk ? n - i : kChunk;
+                kern->mixFloat(&inL[i], &inR[i], mono.data(), m);
+                kern->cascade(filter, mono.data(), m);
+                engine.runPrefiltered(mono.data(), &outL[i], &outR[i], m);
+            }
+            rendered += n;
+        }
+
+        cp.output_hash = checkpointHash(outL.data(), outR.data(), n);
+        ok = out.write(outL.data(), outR.data(), n);
+        next.points.push_back(cp);
+        total += n;
+    }
+
+    // and the state after the last of it
+    if (ok) {
+        Checkpoint cp;
+        cp.input_hash = cp.output_hash = 0;
+        cp.frames = 0;
+        if (following) {
+            // load() makes sure there's a point on the end for this
+            cp.state = old.points[j].state;
+        } else {
+            saveState(engine, filter, *snap, cp.state);
+        }
+        next.points.push_back(cp);
+    }
+    delete snap;
+
+    if (!out.close() || !ok || rename(tmp_path.c_str(), out_path) != 0) {
+        fprintf(stderr, "render: error writing %s\n", out_path);
+        unlink(tmp_path.c_str());
+        return 1;
+    }
+    if (!next.save(ckpt_path.c_str())) fprintf(stderr, "render: couldn't write %s\n", ckpt_path.c_str());
+
+    printf("rendered %.1f of %.1f seconds\n", (double)rendered / in.getRate(), (double)total / in.getRate());
+    return 0;
+}
+
+// out.wav becomes out-01.wav and so on
+static std::string auditionPath(const char *out_path, uint32_t program) {
+    std::string base = out_path;
+    if (base.size() > 4 && !strcasecmp(base.c_str() + base.size() - 4, ".wav")) base.resize(base.size() - 4);
+
+    char name[8];
+    snprintf(name, sizeof(name), "-%02u.wav", program);
+    return base + name;
+}
+
+static int renderAll(WavReader &in, const char *out_path, const RomImage *rom, uint32_t threads) {
+    const uint32_t P = AuditionBank::kPrograms;
+
+    std::vector<WavWriter> outs(P);
+    for (uint32_t p = 0; p < P; p++) {
+        std::string path = auditionPath(out_path, p + 1);
+        if (!outs[p].open(path.c_str(), in.getRate())) {
+            fprintf(stderr, "render: can't write %s\n", path.c_str());
+            return 1;
+        }
+    }
+
+    AuditionBank bank(threads);
+    bank.setSampleRate(in.getRate());
+    bank.setRom(rom);
+    if (!bank.activate()) {
+        fprintf(stderr, "render: couldn't allocate DSP RAM\n");
+        return 1;
+    }
+
+    std::vector<float> inL(kChunk), inR(kChunk), out(2 * P * kChunk);
+    float *outL[P], *outR[P];
+    for (uint32_t p = 0; p < P; p++) {
+        outL[p] = &out[2 * p * kChunk];
+        outR[p] = &out[(2 * p + 1) * kChunk];
+    }
+
+    uint32_t n;
+    while ((n = in.read(inL.data(), inR.data(), kChunk)) > 0) {
+        bank.run(inL.data(), inR.data(), outL, outR, n);
+        for (uint32_t p = 0; p < P; p++) {
+            if (!outs[p].write(outL[p], outR[p], n)) {
+                fprintf(stderr, "render: error writing output for program %u\n", p + 1);
+                return 1;
+            }
+        }
+    }
+
+    for (uint32_t p = 0; p < P; p++) {
+        if (!outs[p].close()) {
+            fprintf(stderr, "render: error writing output for program %u\n", p + 1);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    uint32_t program = 20, threads = 0, cache_mb = 4096;
+    const char *rom_path = nullptr, *cache_dir = nullptr;
+    bool audition = false, incremental = false;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "p:r:aj:c:s:k")) != -1) {
+        switch (opt) {
+            case 'p':
+                program = atoi(optarg);
+                if (program < 1 || program > 64) usage();
+                break;
+            case 'r':
+                rom_path = optarg;
+                break;
+            case 'a':
+                audition = true;
+                break;
+            case 'j':
+                threads = atoi(optarg);
+                break;
+            case 'c':
+                cache_dir = optarg;
+                break;
+            case 's':
+                cache_mb = atoi(optarg);
+                break;
+            case 'k':
+                incremental = true;
+                break;
+            default:
+                usage();
+        }
+    }
+    if (argc - optind != 2 || (audition && incremental)) usage();
+    const char *in_path = argv[optind];
+    const char *out_path = argv[optind + 1];
+
+    WavReader in;
+    if (!in.open(in_path)) {
+        fprintf(stderr, "render: can't read %s, or it isn't a WAV file I understand\n", in_path);
+        return 1;
+    }
+
+    const RomImage *rom = romBuiltin();
+    if (rom_path) {
+        rom = romLoad(rom_path, kRomAuto);
+        if (!rom) {
+            fprintf(stderr, "render: can't load ROM image %s\n", rom_path);
+            return 1;
+        }
+    }
+
+    // each program's output is cached separately, but an audition is only
+    // skipped if every one of them is there
+    RenderCache cache;
+    std::vector<std::string> entries, outputs;
+    if (cache_dir) {
+        if (!cache.open(cache_dir, (uint64_t)cache_mb << 20)) {
+            fprintf(stderr, "render: can't use %s as a cache\n", cache_dir);
+            cache_dir = nullptr;
+        } else if (!cache.hashInput(in_path)) {
+            fprintf(stderr, "render: can't read %s\n", in_path);
+            return 1;
+        }
+    }
+    if (cache_dir) {
+        for (uint32_t p = 1; p <= 64; p++) {
+            if (!audition && p != program) continue;
+            entries.push_back(cache.entry(rom, p, in.getRate()));
+            outputs.push_back(audition ? auditionPath(out_path, p) : out_path);
+        }
+
+        // with -k the checkpoints have to match the output, so it always goes
+        // through renderIncremental(), which is quick enough when nothing has changed
+        bool hit = !incremental;
+        for (size_t i = 0; i < entries.size() && hit; i++) hit = cache.fetch(entries[i], outputs[i].c_str());
+        if (hit) {
+            if (rom_path) romFree(rom);
+            return 0;
+        }
+    }
+
+    int ret;
+    if (audition) {
+        ret = renderAll(in, out_path, rom, threads);
+    } else if (incremental) {
+        ret = renderIncremental(in, out_path, rom, program);
+    } else {
+        ret = renderOne(in, out_path, rom, program);
+    }
+
+    for (size_t i = 0; i < entries.size() && ret == 0; i++) {
+        if (!cache.store(entries[i], outputs[i].c_str())) fprintf(stderr, "render: couldn't add to the cache\n");
+    }
+    if (rom_path) romFree(rom);
+    return ret;
+}
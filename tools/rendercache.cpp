@@ -0,0 +1,155 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "rendercache.hpp"
+
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "kernels.hpp"
+
+static bool copyFile(const char *from, const char *to) {
+    FILE *in = fopen(from, "rb");
+    if (!in) return false;
+    FILE *out = fopen(to, "wb");
+    if (!out) {
+        fclose(in);
+        return false;
+    }
+
+    static char buf[1 << 16];
+    size_t n;
+    bool ok = true;
+    while (ok && (n = fread(buf, 1, sizeof(buf), in)) > 0) ok = fwrite(buf, 1, n, out) == n;
+    ok = ok && !ferror(in);
+    fclose(in);
+    if (fclose(out) != 0) ok = false;
+    if (!ok) unlink(to);
+    return ok;
+}
+
+bool RenderCache::open(const char *dir, uint64_t max_bytes) {
+    this->dir = dir;
+    this->max_bytes = max_bytes;
+    if (mkdir(dir, 0777) != 0 && errno != EEXIST) return false;
+
+    struct stat st;
+    if (stat(dir, &st) != 0 || !S_ISDIR(st.st_mode)) return false;
+
+    // in case the limit has come down since last time
+    trim();
+    return true;
+}
+
+bool RenderCache::hashInput(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+
+    // FNV-1a, as for ROM images
+    static uint8_t buf[1 << 16];
+    uint64_t h = 0xcbf29ce484222325ull, size = 0;
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            h ^= buf[i];
+            h *= 0x100000001b3ull;
+        }
+        size += n;
+    }
+    bool ok = !ferror(f);
+    fclose(f);
+
+    input_hash = h;
+    input_size = size;
+    return ok;
+}
+
+std::string RenderCache::entry(const RomImage *rom, uint32_t program, uint32_t rate) const {
+    // the kernels are in the name in case a variant ever rounds differently
+    char name[160];
+    snprintf(name, sizeof(name), "%016llx-%llu-p%02u-rom%016llx-%s-%u-v%u", (unsigned long long)input_hash,
+             (unsigned long long)input_size, program, (unsigned long long)rom->hash, kernelsSelect()->name, rate,
+             kVersion);
+    return name;
+}
+
+bool RenderCache::fetch(const std::string &entry, const char *path) {
+    std::string cached = pathOf(entry);
+    if (!copyFile(cached.c_str(), path)) return false;
+
+    // it's been used, so it goes to the back of the queue for eviction
+    utimes(cached.c_str(), nullptr);
+    return true;
+}
+
+bool RenderCache::store(const std::string &entry, const char *path) {
+    // copied in under a temporary name, so that nobody else sees half a file
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".tmp%ld", (long)getpid());
+    std::string cached = pathOf(entry), tmp = cached + suffix;
+
+    if (!copyFile(path, tmp.c_str())) return false;
+    if (rename(tmp.c_str(), cached.c_str()) != 0) {
+        unlink(tmp.c_str());
+        return false;
+    }
+    trim();
+    return true;
+}
+
+void RenderCache::trim() {
+    struct File {
+        std::string path;
+        uint64_t size;
+        time_t used;
+    };
+    std::vector<File> files;
+    uint64_t total = 0;
+
+    DIR *d = opendir(dir.c_str());
+    if (!d) return;
+    struct dirent *e;
+    while ((e = readdir(d)) != nullptr) {
+        size_t len = strlen(e->d_name);
+        if (len < 4 || strcmp(e->d_name + len - 4, ".wav")) continue;
+
+        File f;
+        f.path = dir + "/" + e->d_name;
+        struct stat st;
+        if (stat(f.path.c_str(), &st) != 0 || !S_ISREG(st.st_mode)) continue;
+        f.size = st.st_size;
+        f.used = st.st_mtime;
+        files.push_back(f);
+        total += f.size;
+    }
+    closedir(d);
+
+    // least recently used first
+    std::sort(files.begin(), files.end(), [](const File &a, const File &b) { return a.used < b.used; });
+    for (size_t i = 0; i < files.size() && total > max_bytes; i++) {
+        if (unlink(files[i].path.c_str()) == 0) total -= files[i].size;
+    }
+}
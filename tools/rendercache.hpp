@@ -0,0 +1,63 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_RENDERCACHE_HPP
+#define BARRVERB_RENDERCACHE_HPP
+
+#include <stdint.h>
+
+#include <string>
+
+#include "romimage.hpp"
+
+// A directory of finished renders, each named after everything that went
+// into it, so a job that has been done before is a hash and a file copy
+// rather than a render
+// Files are used and added with their modification times bumped, and the
+// oldest are removed whenever it grows past its size limit
+// Several renders can share one, since files only appear in it complete
+class RenderCache {
+   public:
+    // creates the directory if it isn't there, and trims it to size
+    bool open(const char *dir, uint64_t max_bytes);
+
+    // everything the output depends on, as a name for the cache file
+    // The input is hashed by its contents, so the same audio under another
+    // name is still a hit
+    // Bump kVersion whenever a change to the engine changes its output
+    bool hashInput(const char *path);
+    std::string entry(const RomImage *rom, uint32_t program, uint32_t rate) const;
+
+    // copies a cached render out to path, false if there isn't one
+    bool fetch(const std::string &entry, const char *path);
+
+    // copies a finished render in, then trims the cache back to size
+    bool store(const std::string &entry, const char *path);
+
+   private:
+    static const uint32_t kVersion = 1;
+
+    std::string pathOf(const std::string &entry) const { return dir + "/" + entry + ".wav"; }
+    void trim();
+
+    std::string dir;
+    uint64_t max_bytes = 0;
+    uint64_t input_hash = 0, input_size = 0;
+};
+
+#endif  // BARRVERB_RENDERCACHE_HPP
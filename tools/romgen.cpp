@@ -0,0 +1,315 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+// Generates rom.h from an EPROM dump of the MIDIVerb DSP ROM
+//
+// usage: romgen [-p] [-i image] [-f families] [-n kernels] [-v steps] dump names > rom.h
+//
+//   -p           the dump has already been permuted, with or without a header
+//   -i image     also write a permuted image that the plugin can load
+//   -f families  also write the engine's family kernels, families.h
+//   -n kernels   the most family kernels to write, 6 by default
+//   -v steps     how many steps a family's programs may differ in, 64 by default
+//
+// names is a text file with one program name per line
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "romimage.hpp"
+
+static void usage() {
+    fprintf(stderr, "usage: romgen [-p] [-i image] [-f families] [-n kernels] [-v steps] dump names > rom.h\n");
+    exit(1);
+}
+
+// Family kernels
+//
+// Programs are grouped by the kind of each of their steps, the top two bits
+// of each word, which is what decides the code the engine runs for it
+// Each family gets a kernel of its own, with the steps unrolled and the kind
+// of every step the whole family agrees on built in, so there's nothing to
+// dispatch, and the kind of the steps where they differ taken from the ROM
+// word at run time, a branch that always goes the same way for a program
+// The offsets are always read from the ROM, so one kernel runs every program
+// in its family, and any program in any ROM that fits the pattern
+// A kernel per program would be quicker still, but at 4 or 5kB each they
+// would be far too big to stay in the instruction cache with a few
+// different programs running, so there are only ever a few kernels
+// Every program starts out as a family of its own, and the two families
+// that add the fewest looked up steps between them are merged until there
+// are few enough, then the programs in a family left with one program, or
+// one that differs in too many steps to be worth it, go to the threaded
+// interpreter
+
+struct Family {
+    std::vector<uint32_t> members;
+    int kinds[128];  // -1 where the members differ
+};
+
+// the steps a family looks up, over all of its programs
+static uint32_t cost(const Family &f) {
+    uint32_t varying = 0;
+    for (uint32_t step = 0; step < 128; step++) varying += f.kinds[step] < 0;
+    return varying * f.members.size();
+}
+
+static Family merge(const Family &a, const Family &b) {
+    Family f = a;
+    f.members.insert(f.members.end(), b.members.begin(), b.members.end());
+    for (uint32_t step = 0; step < 128; step++) {
+        if (f.kinds[step] != b.kinds[step]) f.kinds[step] = -1;
+    }
+    return f;
+}
+
+static std::vector<Family> findFamilies(const uint16_t *words, uint32_t max_families, uint32_t max_differing) {
+    std::vector<Family> families(kRomWords / 128);
+    for (uint32_t prog = 0; prog < kRomWords / 128; prog++) {
+        families[prog].members.push_back(prog);
+        for (uint32_t step = 0; step < 128; step++) families[prog].kinds[step] = words[prog * 128 + step] >> 14;
+    }
+
+    while (families.size() > max_families) {
+        size_t best_a = 0, best_b = 1;
+        uint32_t best_cost = UINT32_MAX;
+        for (size_t a = 0; a < families.size(); a++) {
+            for (size_t b = a + 1; b < families.size(); b++) {
+                uint32_t c = cost(merge(families[a], families[b])) - cost(families[a]) - cost(families[b]);
+                if (c < best_cost) {
+                    best_a = a;
+                    best_b = b;
+                    best_cost = c;
+                }
+            }
+        }
+        families[best_a] = merge(families[best_a], families[best_b]);
+        families.erase(families.begin() + best_b);
+    }
+
+    // in program order, which is the order the engine tries them in
+    std::vector<Family> kept;
+    for (Family &f : families) {
+        std::sort(f.members.begin(), f.members.end());
+        if (f.members.size() > 1 && cost(f) <= max_differing * f.members.size()) kept.push_back(f);
+    }
+    std::sort(kept.begin(), kept.end(), [](const Family &a, const Family &b) { return a.members[0] < b.members[0]; });
+    return kept;
+}
+
+static bool writeFamilies(const char *path, const char *base, const std::vector<Family> &families,
+                          const std::vector<std::string> &names) {
+    FILE *f = fopen(path, "w");
+    if (!f) return false;
+
+    fprintf(f, "// generated by tools/romgen from %s, do not edit\n", base);
+    fprintf(f, "// the engine's family kernels, see romgen.cpp and engine.cpp\n\n");
+    fprintf(f, "#ifndef BARRVERB_FAMILIES_H\n#define BARRVERB_FAMILIES_H\n\n");
+
+    for (size_t i = 0; i < families.size(); i++) {
+        const Family &fam = families[i];
+        uint32_t varying = 0;
+        for (uint32_t step = 0; step < 128; step++) varying += fam.kinds[step] < 0;
+
+        fprintf(f, "// %u varying steps\n", varying);
+        for (size_t m = 0; m < fam.members.size(); m++) {
+            fprintf(f, "//   %2u %s\n", fam.members[m] + 1, names[fam.members[m]].c_str());
+        }
+        fprintf(f, "FAMILY_KERNEL(family%zu,\n", i);
+        for (uint32_t step = 0; step < 128; step += 8) {
+            fprintf(f, "   ");
+            for (uint32_t s = step; s < step + 8; s++) {
+                if (fam.kinds[s] < 0) {
+                    fprintf(f, " FAMILY_ANY(%3u)", s);
+                } else {
+                    fprintf(f, " FAMILY_STEP(%3u, %d)", s, fam.kinds[s]);
+                }
+            }
+            fprintf(f, "\n");
+        }
+        fprintf(f, ")\n\n");
+    }
+
+    // the kind of each step as a pattern to match programs against, x where any will do
+    fprintf(f, "static const FamilyInfo families[] = {\n");
+    for (size_t i = 0; i < families.size(); i++) {
+        fprintf(f, "    {family%zu,\n", i);
+        for (uint32_t step = 0; step < 128; step += 64) {
+            fprintf(f, "     \"");
+            for (uint32_t s = step; s < step + 64; s++) {
+                fputc(families[i].kinds[s] < 0 ? 'x' : '0' + families[i].kinds[s], f);
+            }
+            fprintf(f, "\"%s\n", step ? "}," : "");
+        }
+    }
+    fprintf(f, "};\n\n#endif  // BARRVERB_FAMILIES_H\n");
+
+    return fclose(f) == 0;
+}
+
+static bool readFile(const char *path, std::vector<uint8_t> &data) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+
+    uint8_t buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + n);
+    fclose(f);
+    return true;
+}
+
+static bool readNames(const char *path, std::vector<std::string> &names) {
+    FILE *f = fopen(path, "r");
+    if (!f) return false;
+
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        size_t len = strcspn(line, "\r\n");
+        line[len] = 0;
+        names.push_back(line);
+    }
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    RomFormat format = kRomRaw;
+    const char *image_path = nullptr;
+    const char *families_path = nullptr;
+    uint32_t max_families = 6, max_differing = 64;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "pi:f:n:v:")) != -1) {
+        switch (opt) {
+            case 'p':
+                format = kRomPermuted;
+                break;
+            case 'i':
+                image_path = optarg;
+                break;
+            case 'f':
+                families_path = optarg;
+                break;
+            case 'n':
+                max_families = atoi(optarg);
+                break;
+            case 'v':
+                max_differing = atoi(optarg);
+                break;
+            default:
+                usage();
+        }
+    }
+    if (argc - optind != 2) usage();
+    const char *dump_path = argv[optind];
+    const char *names_path = argv[optind + 1];
+
+    std::vector<uint8_t> data;
+    if (!readFile(dump_path, data)) {
+        fprintf(stderr, "romgen: can't read %s\n", dump_path);
+        return 1;
+    }
+
+    uint16_t words[kRomWords];
+    if (!romDecode(data.data(), data.size(), format, words)) {
+        fprintf(stderr, "romgen: %s is %zu bytes, expected a %u byte ROM\n", dump_path, data.size(), kRomBytes);
+        return 1;
+    }
+
+    std::vector<std::string> names;
+    if (!readNames(names_path, names)) {
+        fprintf(stderr, "romgen: can't read %s\n", names_path);
+        return 1;
+    }
+    if (names.size() != kRomWords / 128) {
+        fprintf(stderr, "romgen: %s has %zu names, expected %u\n", names_path, names.size(), kRomWords / 128);
+        return 1;
+    }
+    for (size_t i = 0; i < names.size(); i++) {
+        if (names[i].empty() || names[i].find_first_of("\"\\") != std::string::npos) {
+            fprintf(stderr, "romgen: name for program %zu is empty or can't be quoted\n", i + 1);
+            return 1;
+        }
+    }
+
+    // The ADC writes the input to RAM at step 0x00 and the DACs latch what's
+    // read at steps 0x60 and 0x70, so every MIDIVerb program reads RAM on
+    // those steps, bit 15 clear, to pass the old sample on and to give its
+    // outputs, and a dump that's the wrong way round won't
+    for (uint32_t prog = 0; prog < kRomWords; prog += 128) {
+        if ((words[prog] | words[prog + 0x60] | words[prog + 0x70]) & 0x8000) {
+            fprintf(stderr,
+                    "romgen: program %u doesn't read RAM at the ADC step 0x00 and the DAC steps 0x60 and 0x70, "
+                    "is the dump the right way round?\n",
+                    prog / 128 + 1);
+            return 1;
+        }
+    }
+
+    if (image_path) {
+        FILE *f = fopen(image_path, "wb");
+        if (!f) {
+            fprintf(stderr, "romgen: can't write %s\n", image_path);
+            return 1;
+        }
+        fwrite(ROM_IMAGE_MAGIC, 1, kRomMagicSize, f);
+        for (uint32_t i = 0; i < kRomWords; i++) {
+            uint8_t b[2] = {(uint8_t)words[i], (uint8_t)(words[i] >> 8)};
+            fwrite(b, 1, 2, f);
+        }
+        fclose(f);
+    }
+
+    const char *base = strrchr(dump_path, '/');
+    base = base ? base + 1 : dump_path;
+
+    if (families_path && !writeFamilies(families_path, base, findFamilies(words, max_families, max_differing), names)) {
+        fprintf(stderr, "romgen: can't write %s\n", families_path);
+        return 1;
+    }
+
+    printf("// generated by tools/romgen from %s, do not edit\n", base);
+    printf("// the words have already had the opcode/offset prefetch permutation applied\n\n");
+    printf("#ifndef BARRVERB_ROM_H\n#define BARRVERB_ROM_H\n\n#include <stdint.h>\n\n");
+
+    printf("constexpr const char *prog_name[] = {\n");
+    for (size_t i = 0; i < names.size(); i++) {
+        printf("    \"%s\",\n", names[i].c_str());
+    }
+    printf("};\n\n");
+
+    printf("constexpr uint16_t rom[] = {\n");
+    for (uint32_t prog = 0; prog < kRomWords; prog += 128) {
+        printf("    // Program %2u, 0x%04x\n", prog / 128, prog * 2);
+        for (uint32_t step = 0; step < 128; step += 8) {
+            printf("   ");
+            for (uint32_t i = 0; i < 8; i++) printf(" 0x%04x,", words[prog + step + i]);
+            printf("\n");
+        }
+    }
+    printf("};\n\n#endif  // BARRVERB_ROM_H\n");
+
+    return 0;
+}
@@ -0,0 +1,485 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+// Checks that BarrVerb really is realtime safe, as DistrhoPluginInfo.h says
+//
+// usage: rtcheck
+//
+// The plugin is driven through DPF's PluginExporter the way a host wrapper
+// drives it, with malloc, operator new, mutexes, condition variables,
+// semaphores and the blocking system calls all interposed
+// Any of those called on the audio thread, from run() or from parameter and
+// program changes made between blocks, or on the plugin's engine thread
+// while it's working, fails the check
+// It goes through every program at a range of block sizes, program changes
+// mid-stream, restoring and capturing snapshots, and loading ROM images, with
+// telemetry being published all the while
+// The malloc hooks need glibc, the rest work anywhere with dlsym()
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <thread>
+
+// the parts of DPF that every plugin format is built on, as DistrhoPluginMain.cpp has them
+#include "src/DistrhoPlugin.cpp"
+#include "src/DistrhoUtils.cpp"
+
+#include "barrverb.hpp"
+#include "romimage.hpp"
+
+// Violations
+
+static thread_local bool audio_thread = false;
+
+static const uint32_t kMaxReported = 16;
+static std::atomic<uint32_t> violations{0};
+static std::atomic<const char *> reported[kMaxReported];  // each different call once
+
+// called from every hook, so it mustn't allocate or lock itself
+// the plugin's engine thread counts as an audio thread too, so the list is
+// filled in a slot at a time by whichever gets there first
+static void violation(const char *what) {
+    if (!audio_thread) return;
+    violations.fetch_add(1);
+    for (uint32_t i = 0; i < kMaxReported; i++) {
+        const char *seen = nullptr;
+        if (reported[i].compare_exchange_strong(seen, what) || seen == what) return;
+    }
+}
+
+// Allocation
+
+#ifdef __GLIBC__
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void *__libc_memalign(size_t align, size_t size);
+void __libc_free(void *ptr);
+
+void *malloc(size_t size) {
+    violation("malloc");
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+    violation("calloc");
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+    violation("realloc");
+    return __libc_realloc(ptr, size);
+}
+
+void *memalign(size_t align, size_t size) {
+    violation("memalign");
+    return __libc_memalign(align, size);
+}
+
+void *aligned_alloc(size_t align, size_t size) {
+    violation("aligned_alloc");
+    return __libc_memalign(align, size);
+}
+
+int posix_memalign(void **ptr, size_t align, size_t size) {
+    violation("posix_memalign");
+    *ptr = __libc_memalign(align, size);
+    return *ptr ? 0 : ENOMEM;
+}
+
+void free(void *ptr) {
+    if (ptr) violation("free");
+    __libc_free(ptr);
+}
+}
+
+static void *rawAlloc(size_t size) {
+    return __libc_malloc(size ? size : 1);
+}
+
+static void rawFree(void *ptr) {
+    __libc_free(ptr);
+}
+#else
+static void *rawAlloc(size_t size) {
+    return malloc(size ? size : 1);
+}
+
+static void rawFree(void *ptr) {
+    free(ptr);
+}
+#endif
+
+void *operator new(size_t size) {
+    violation("operator new");
+    void *ptr = rawAlloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void *operator new[](size_t size) {
+    violation("operator new[]");
+    void *ptr = rawAlloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+    violation("operator new");
+    return rawAlloc(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+    violation("operator new[]");
+    return rawAlloc(size);
+}
+
+void operator delete(void *ptr) noexcept {
+    if (ptr) violation("operator delete");
+    rawFree(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+    if (ptr) violation("operator delete[]");
+    rawFree(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    if (ptr) violation("operator delete");
+    rawFree(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+    if (ptr) violation("operator delete[]");
+    rawFree(ptr);
+}
+
+// Locks and system calls, forwarded to the next definition along
+// The real functions are looked up before the checks start, since dlsym()
+// can allocate, and lazily for anything that runs before main()
+
+#define HOOK(ret, name, params, args)                                       \
+    static ret(*real_##name) params = nullptr;                              \
+    extern "C" ret name params {                                            \
+        violation(#name);                                                   \
+        if (!real_##name) real_##name = (ret(*) params)dlsym(RTLD_NEXT, #name); \
+        return real_##name args;                                            \
+    }
+
+HOOK(int, pthread_mutex_lock, (pthread_mutex_t * m), (m))
+HOOK(int, pthread_mutex_trylock, (pthread_mutex_t * m), (m))
+HOOK(int, pthread_rwlock_rdlock, (pthread_rwlock_t * l), (l))
+HOOK(int, pthread_rwlock_wrlock, (pthread_rwlock_t * l), (l))
+HOOK(int, pthread_cond_wait, (pthread_cond_t * c, pthread_mutex_t *m), (c, m))
+HOOK(int, pthread_cond_timedwait, (pthread_cond_t * c, pthread_mutex_t *m, const struct timespec *t), (c, m, t))
+HOOK(int, pthread_join, (pthread_t t, void **r), (t, r))
+HOOK(int, sem_timedwait, (sem_t * s, const struct timespec *t), (s, t))
+HOOK(int, nanosleep, (const struct timespec *t, struct timespec *r), (t, r))
+HOOK(int, clock_nanosleep, (clockid_t c, int f, const struct timespec *t, struct timespec *r), (c, f, t, r))
+HOOK(int, usleep, (useconds_t u), (u))
+HOOK(int, sched_yield, (void), ())
+HOOK(ssize_t, read, (int fd, void *buf, size_t n), (fd, buf, n))
+HOOK(ssize_t, write, (int fd, const void *buf, size_t n), (fd, buf, n))
+HOOK(int, close, (int fd), (fd))
+HOOK(void *, mmap, (void *a, size_t n, int p, int f, int fd, off_t o), (a, n, p, f, fd, o))
+HOOK(int, munmap, (void *a, size_t n), (a, n))
+HOOK(int, mlock, (const void *a, size_t n), (a, n))
+HOOK(int, madvise, (void *a, size_t n, int adv), (a, n, adv))
+
+// The plugin's engine thread is an audio thread from being woken up until it
+// goes back to sleep for the next chunk, and threads started while
+// engine_starting is set are taken to be one
+// Its sleep is the only sem_wait() it's allowed, and nothing after
+// engine_stopping is set counts, since that's it being told to quit
+static thread_local bool engine_thread = false;
+static std::atomic<bool> engine_starting{false}, engine_stopping{false};
+
+struct ThreadStart {
+    void *(*f)(void *);
+    void *arg;
+};
+
+static void *engineThread(void *p) {
+    ThreadStart start = *(ThreadStart *)p;
+    rawFree(p);
+    engine_thread = true;
+    return start.f(start.arg);
+}
+
+static int (*real_pthread_create)(pthread_t *, const pthread_attr_t *, void *(*)(void *), void *) = nullptr;
+extern "C" int pthread_create(pthread_t *t, const pthread_attr_t *a, void *(*f)(void *), void *arg) {
+    violation("pthread_create");
+    if (!real_pthread_create) {
+        real_pthread_create = (decltype(real_pthread_create))dlsym(RTLD_NEXT, "pthread_create");
+    }
+    if (!engine_starting.load()) return real_pthread_create(t, a, f, arg);
+
+    ThreadStart *start = (ThreadStart *)rawAlloc(sizeof(ThreadStart));
+    start->f = f;
+    start->arg = arg;
+    int err = real_pthread_create(t, a, engineThread, start);
+    if (err) rawFree(start);
+    return err;
+}
+
+static int (*real_sem_wait)(sem_t *) = nullptr;
+extern "C" int sem_wait(sem_t *s) {
+    if (engine_thread) {
+        audio_thread = false;
+    } else {
+        violation("sem_wait");
+    }
+    if (!real_sem_wait) real_sem_wait = (int (*)(sem_t *))dlsym(RTLD_NEXT, "sem_wait");
+    int err = real_sem_wait(s);
+    if (engine_thread && !engine_stopping.load()) audio_thread = true;
+    return err;
+}
+
+// open() is variadic, so it can't go through HOOK
+static int (*real_open)(const char *, int, ...) = nullptr;
+extern "C" int open(const char *path, int flags, ...) {
+    violation("open");
+    if (!real_open) real_open = (int (*)(const char *, int, ...))dlsym(RTLD_NEXT, "open");
+    mode_t mode = 0;
+    if (flags & O_CREAT) {
+        va_list args;
+        va_start(args, flags);
+        mode = va_arg(args, int);
+        va_end(args);
+    }
+    return real_open(path, flags, mode);
+}
+
+static void resolveHooks() {
+#define RESOLVE(name) real_##name = (decltype(real_##name))dlsym(RTLD_NEXT, #name)
+    RESOLVE(pthread_mutex_lock);
+    RESOLVE(pthread_mutex_trylock);
+    RESOLVE(pthread_rwlock_rdlock);
+    RESOLVE(pthread_rwlock_wrlock);
+    RESOLVE(pthread_cond_wait);
+    RESOLVE(pthread_cond_timedwait);
+    RESOLVE(pthread_join);
+    RESOLVE(pthread_create);
+    RESOLVE(sem_wait);
+    RESOLVE(sem_timedwait);
+    RESOLVE(nanosleep);
+    RESOLVE(clock_nanosleep);
+    RESOLVE(usleep);
+    RESOLVE(sched_yield);
+    RESOLVE(read);
+    RESOLVE(write);
+    RESOLVE(close);
+    RESOLVE(mmap);
+    RESOLVE(munmap);
+    RESOLVE(mlock);
+    RESOLVE(madvise);
+    RESOLVE(open);
+#undef RESOLVE
+}
+
+// The host
+
+USE_NAMESPACE_DISTRHO
+
+static const uint32_t kMaxBlock = 4096;
+static float in_buf[2][kMaxBlock], out_buf[2][kMaxBlock];
+static const float *inputs[2] = {in_buf[0], in_buf[1]};
+static float *outputs[2] = {out_buf[0], out_buf[1]};
+
+static void fillInput() {
+    uint32_t seed = 1;
+    for (uint32_t i = 0; i < kMaxBlock; i++) {
+        seed = seed * 1664525 + 1013904223;
+        in_buf[0][i] = (int32_t)seed / 4294967296.0f;
+        in_buf[1][i] = -in_buf[0][i];
+    }
+}
+
+// one host callback, everything in here counts as the audio thread
+template <class F>
+static void audio(F f) {
+    audio_thread = true;
+    f();
+    audio_thread = false;
+}
+
+static void block(PluginExporter &plugin, uint32_t frames) {
+    audio([&] { plugin.run(inputs, outputs, frames); });
+}
+
+static bool report(const char *what) {
+    uint32_t n = violations.exchange(0);
+    if (!n) {
+        printf("ok    %s\n", what);
+        return true;
+    }
+
+    printf("FAIL  %s, %u calls that aren't realtime safe:", what, n);
+    for (uint32_t i = 0; i < kMaxReported; i++) {
+        const char *what = reported[i].exchange(nullptr);
+        if (what) printf(" %s", what);
+    }
+    printf("\n");
+    return false;
+}
+
+// keep the audio thread going while something else happens on a control thread
+template <class F>
+static void whileRunning(PluginExporter &plugin, F f) {
+    std::atomic<bool> finished{false};
+    std::thread control([&] {
+        f();
+        finished.store(true);
+    });
+    while (!finished.load()) {
+        block(plugin, 256);
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+    control.join();
+
+    // and a few more blocks to pick up whatever was handed over
+    for (int i = 0; i < 8; i++) block(plugin, 256);
+}
+
+static bool writeRomImage(const char *path) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return false;
+
+    const RomImage *rom = romBuiltin();
+    fwrite(ROM_IMAGE_MAGIC, 1, kRomMagicSize, f);
+    for (uint32_t i = 0; i < kRomWords; i++) {
+        uint8_t b[2] = {(uint8_t)rom->words[i], (uint8_t)(rom->words[i] >> 8)};
+        fwrite(b, 1, 2, f);
+    }
+    return fclose(f) == 0;
+}
+
+int main() {
+    resolveHooks();
+    fillInput();
+
+    static const uint32_t sizes[] = {1, 2, 3, 17, 64, 128, 255, 256, 257, 511, 512, 1000, 1024, 2048, 4096};
+    const uint32_t kSizes = sizeof(sizes) / sizeof(sizes[0]);
+    bool ok = true;
+
+    // a telemetry segment of its own, so that run() publishes to it
+    char segment[32];
+    snprintf(segment, sizeof(segment), "/barrverb-rtcheck-%d", (int)getpid());
+    setenv("BARRVERB_TELEMETRY", segment, 1);
+
+    d_nextBufferSize = kMaxBlock;
+    d_nextSampleRate = 48000;
+    PluginExporter plugin(nullptr, nullptr, nullptr, nullptr);
+    plugin.activate();
+
+    // every program at every block size, changed from the audio thread
+    for (uint32_t prog = 0; prog < 64; prog++) {
+        audio([&] { plugin.setParameterValue(BarrVerb::paramProgram, prog + 1); });
+        for (uint32_t i = 0; i < kSizes; i++) block(plugin, sizes[i]);
+    }
+    ok &= report("every program at block sizes from 1 to 4096");
+
+    // program changes every block, through both routes a host might take,
+    // with the meters read back as hosts do
+    for (uint32_t i = 0; i < 256; i++) {
+        audio([&] {
+            if (i & 1) {
+                plugin.loadProgram((i * 37) & 63);
+            } else {
+                plugin.setParameterValue(BarrVerb::paramProgram, ((i * 11) & 63) + 1);
+            }
+            plugin.getParameterValue(BarrVerb::paramLoad);
+            plugin.getParameterValue(BarrVerb::paramPeakLoad);
+        });
+        block(plugin, sizes[i % kSizes]);
+    }
+    ok &= report("program changes every block");
+
+    // capturing a snapshot for the host while it runs, and restoring it again
+    audio([&] { plugin.setParameterValue(BarrVerb::paramSaveTail, 1); });
+    for (int i = 0; i < 4; i++) {
+        String snapshot;
+        whileRunning(plugin, [&] { snapshot = plugin.getStateValue("snapshot"); });
+        whileRunning(plugin, [&] { plugin.setState("snapshot", snapshot); });
+    }
+    ok &= report("snapshot capture and restore");
+
+    // swapping ROM images in and back out
+    char path[] = "/tmp/rtcheck-rom-XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0 || !writeRomImage(path)) {
+        printf("FAIL  couldn't write a ROM image to %s\n", path);
+        return 1;
+    }
+    close(fd);
+    for (int i = 0; i < 4; i++) {
+        whileRunning(plugin, [&] {
+            plugin.setState("rom", path);
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        });
+        whileRunning(plugin, [&] {
+            plugin.setState("rom", "");
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        });
+    }
+    unlink(path);
+    ok &= report("ROM image loading");
+
+    // a sample rate change, which the host makes with the plugin deactivated
+    plugin.deactivate();
+    plugin.setSampleRate(44100, true);
+    plugin.activate();
+    for (uint32_t i = 0; i < kSizes; i++) block(plugin, sizes[i]);
+    ok &= report("running after a sample rate change");
+
+    // with the engine on a thread of its own, run() only passes audio through
+    // and the thread does the work, so both are checked
+    plugin.deactivate();
+    plugin.setParameterValue(BarrVerb::paramThreadLatency, 20);
+    engine_starting.store(true);
+    plugin.activate();
+    engine_starting.store(false);
+    for (uint32_t i = 0; i < 256; i++) {
+        audio([&] { plugin.setParameterValue(BarrVerb::paramProgram, ((i * 11) & 63) + 1); });
+        block(plugin, sizes[i % kSizes]);
+    }
+    // for the thread to catch up with the last of it
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ok &= report("running the engine on a thread of its own");
+
+    engine_stopping.store(true);
+    plugin.deactivate();
+    shm_unlink(segment);
+    printf(ok ? "run() is realtime safe\n" : "run() is NOT realtime safe\n");
+    return ok ? 0 : 1;
+}
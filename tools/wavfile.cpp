@@ -0,0 +1,188 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "wavfile.hpp"
+
+#include <string.h>
+
+static uint32_t get32(const uint8_t *p) {
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint16_t get16(const uint8_t *p) {
+    return p[0] | p[1] << 8;
+}
+
+static void put32(uint8_t *p, uint32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+static void put16(uint8_t *p, uint16_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+WavReader::~WavReader() {
+    if (f) fclose(f);
+}
+
+bool WavReader::open(const char *path) {
+    f = fopen(path, "rb");
+    if (!f) return false;
+
+    uint8_t hdr[12];
+    if (fread(hdr, 1, 12, f) != 12 || memcmp(hdr, "RIFF", 4) || memcmp(hdr + 8, "WAVE", 4)) return false;
+
+    // walk the chunks until the data, picking up the format on the way
+    bool have_format = false;
+    for (;;) {
+        uint8_t chunk[8];
+        if (fread(chunk, 1, 8, f) != 8) return false;
+        uint32_t size = get32(chunk + 4);
+
+        if (!memcmp(chunk, "fmt ", 4)) {
+            uint8_t fmt[40];
+            if (size < 16 || size > sizeof(fmt)) return false;
+            if (fread(fmt, 1, size, f) != size) return false;
+
+            uint16_t tag = get16(fmt);
+            channels = get16(fmt + 2);
+            rate = get32(fmt + 4);
+            bits = get16(fmt + 14);
+            if (tag == 0xfffe && size >= 26) tag = get16(fmt + 24);  // WAVE_FORMAT_EXTENSIBLE
+
+            is_float = tag == 3;
+            if (tag != 1 && tag != 3) return false;
+            if (is_float ? bits != 32 : (bits != 16 && bits != 24 && bits != 32)) return false;
+            if (!channels || !rate) return false;
+            have_format = true;
+        } else if (!memcmp(chunk, "data", 4)) {
+            if (!have_format) return false;
+            remaining = size / (channels * bits / 8);
+            return true;
+        } else {
+            if (fseek(f, size, SEEK_CUR)) return false;
+        }
+        if ((size & 1) && fseek(f, 1, SEEK_CUR)) return false;  // chunks are word aligned
+    }
+}
+
+uint32_t WavReader::read(float *left, float *right, uint32_t frames) {
+    uint32_t stride = channels * bits / 8;
+    uint32_t done = 0;
+
+    while (done < frames && remaining) {
+        uint32_t n = frames - done;
+        if (n > remaining) n = remaining;
+        if (n > sizeof(buf) / stride) n = sizeof(buf) / stride;
+
+        n = fread(buf, stride, n, f);
+        if (!n) break;
+
+        for (uint32_t i = 0; i < n; i++) {
+            const uint8_t *p = buf + i * stride;
+            float v[2];
+            for (uint32_t c = 0; c < 2; c++) {
+                const uint8_t *s = p + (c < channels ? c : 0) * bits / 8;
+                if (is_float) {
+                    uint32_t w = get32(s);
+                    memcpy(&v[c], &w, 4);
+                } else if (bits == 16) {
+                    v[c] = (int16_t)get16(s) / 32768.0f;
+                } else if (bits == 24) {
+                    int32_t w = (int32_t)((uint32_t)s[0] << 8 | (uint32_t)s[1] << 16 | (uint32_t)s[2] << 24) >> 8;
+                    v[c] = w / 8388608.0f;
+                } else {
+                    v[c] = (int32_t)get32(s) / 2147483648.0f;
+                }
+            }
+            left[done + i] = v[0];
+            right[done + i] = v[1];
+        }
+        done += n;
+        remaining -= n;
+    }
+    return done;
+}
+
+WavWriter::~WavWriter() {
+    close();
+}
+
+bool WavWriter::open(const char *path, uint32_t rate) {
+    f = fopen(path, "wb");
+    if (!f) return false;
+    frames_written = 0;
+
+    // sizes are filled in by close()
+    uint8_t hdr[44];
+    memcpy(hdr, "RIFF", 4);
+    put32(hdr + 4, 0);
+    memcpy(hdr + 8, "WAVEfmt ", 8);
+    put32(hdr + 16, 16);
+    put16(hdr + 20, 1);
+    put16(hdr + 22, 2);
+    put32(hdr + 24, rate);
+    put32(hdr + 28, rate * 4);
+    put16(hdr + 32, 4);
+    put16(hdr + 34, 16);
+    memcpy(hdr + 36, "data", 4);
+    put32(hdr + 40, 0);
+    return fwrite(hdr, 1, 44, f) == 44;
+}
+
+bool WavWriter::write(const float *left, const float *right, uint32_t frames) {
+    uint8_t buf[4096];
+
+    while (frames) {
+        uint32_t n = frames < sizeof(buf) / 4 ? frames : sizeof(buf) / 4;
+        for (uint32_t i = 0; i < n; i++) {
+            const float v[2] = {left[i], right[i]};
+            for (uint32_t c = 0; c < 2; c++) {
+                float s = v[c] * 32768.0f;
+                if (s > 32767) s = 32767;
+                if (s < -32768) s = -32768;
+                put16(buf + 4 * i + 2 * c, (int16_t)s);
+            }
+        }
+        if (fwrite(buf, 4, n, f) != n) return false;
+
+        left += n;
+        right += n;
+        frames -= n;
+        frames_written += n;
+    }
+    return true;
+}
+
+bool WavWriter::close() {
+    if (!f) return true;
+
+    uint8_t size[4];
+    bool ok = true;
+    put32(size, 36 + frames_written * 4);
+    ok &= !fseek(f, 4, SEEK_SET) && fwrite(size, 1, 4, f) == 4;
+    put32(size, frames_written * 4);
+    ok &= !fseek(f, 40, SEEK_SET) && fwrite(size, 1, 4, f) == 4;
+    ok &= !fclose(f);
+    f = nullptr;
+    return ok;
+}
@@ -0,0 +1,62 @@
+/*
+   BarrVerb reverb plugin
+
+   Copyright 2024 Gordon JC Pearce <gordonjcp@gjcp.net>
+
+   Permission to use, copy, modify, and/or distribute this software for any
+   purpose with or without fee is hereby granted, provided that the above
+   copyright notice and this permission notice appear in all copies.
+
+   THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+   WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY
+   SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+   WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN ACTION
+   OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+   CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef BARRVERB_WAVFILE_HPP
+#define BARRVERB_WAVFILE_HPP
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Just enough WAV for the command-line tools
+// Reads 16, 24 and 32-bit PCM and 32-bit float, with any number of channels
+class WavReader {
+   public:
+    ~WavReader();
+
+    bool open(const char *path);
+
+    uint32_t getRate() const { return rate; }
+    uint32_t getChannels() const { return channels; }
+
+    // the first two channels as planar float, or the only one twice over
+    // returns the number of frames read, 0 at the end
+    uint32_t read(float *left, float *right, uint32_t frames);
+
+   private:
+    FILE *f = nullptr;
+    uint32_t rate = 0, channels = 0, bits = 0;
+    bool is_float = false;
+    uint32_t remaining = 0;  // frames left in the data chunk
+    uint8_t buf[65536];
+};
+
+// Writes 16-bit stereo PCM, which holds the 12-bit DAC output exactly
+class WavWriter {
+   public:
+    ~WavWriter();
+
+    bool open(const char *path, uint32_t rate);
+    bool write(const float *left, const float *right, uint32_t frames);
+    bool close();  // fills in the sizes in the header
+
+   private:
+    FILE *f = nullptr;
+    uint32_t frames_written = 0;
+};
+
+#endif  // BARRVERB_WAVFILE_HPP